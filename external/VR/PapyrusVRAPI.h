@@ -1,16 +1,16 @@
-#pragma once
-#include <vector>
-#include <functional>
-#include "VRManagerAPI.h"
-#include "VRHookAPI.h"
-#include "PapyrusVRTypes.h"
-
-static const uint32_t kPapyrusVR_Message_Init = 40008;
-
-struct PapyrusVRAPI
-{
-	//Functions
-	//std::function<void(OnPoseUpdateCallback)> RegisterPoseUpdateListener; Discontinued
-	std::function<PapyrusVR::VRManagerAPI*(void)> GetVRManager;
-	std::function<OpenVRHookManagerAPI*(void)> GetOpenVRHook;
+#pragma once
+#include <vector>
+#include <functional>
+#include "VRManagerAPI.h"
+#include "VRHookAPI.h"
+#include "PapyrusVRTypes.h"
+
+static const uint32_t kPapyrusVR_Message_Init = 40008;
+
+struct PapyrusVRAPI
+{
+	//Functions
+	//std::function<void(OnPoseUpdateCallback)> RegisterPoseUpdateListener; Discontinued
+	std::function<PapyrusVR::VRManagerAPI*(void)> GetVRManager;
+	std::function<OpenVRHookManagerAPI*(void)> GetOpenVRHook;
 };
\ No newline at end of file
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/* The nocking state machine as a constexpr transition table. The callbacks in main_plugin reduce
+* what they observe to an ArrowInput and carry out the actions of the transition it selects.
+* Nothing here touches the game, so the table is model checked at compile time (see the
+* static_assert at the end).
+*/
+namespace arrownock
+{
+	enum class ArrowState : uint8_t
+	{
+		// No arrow equipped or no buttons held
+		kIdle = 0,
+		// An arrow has been equipped and we are waiting for it to overlap with the bow
+		kArrowHeld,
+		// Arrow button is held and the arrow was brought to the bow, now we are trying to nock it
+		kTryToNock,
+		// Arrow was nocked successfully, just waiting for button to be released
+		kArrowNocked,
+		kCount
+	};
+
+	enum class ArrowInput : uint8_t
+	{
+		// arrow equipped while holding a bow, with or without one of the arrow buttons held
+		kEquipWithButton = 0,
+		kEquipNoButton,
+		kUnequip,
+		// the button held when the arrow was equipped
+		kButtonUp,
+		kButtonDownInGrace,
+		kButtonDownLate,
+		// arrow hand and bow, once per frame
+		kOverlap,
+		kOverlapLowStamina,       // not enough stamina to draw, autorecover on
+		kOverlapLowStaminaLatch,  // not enough stamina to draw, blocks until the hand leaves
+		kOverlapBlocked,          // stamina block still latched
+		kNoOverlap,
+		kAttemptTick,  // overlapping and frames_between_attempts have passed
+		kNocked,
+		// autonocking turned off or a save loaded, the only input handled while turned off
+		kReset,
+		kCount
+	};
+
+	/* Side effects of a transition, as bit flags */
+	struct ArrowAction
+	{
+		enum : uint16_t
+		{
+			kNone = 0,
+			kCaptureArrow = 1 << 0,    // store the unbent bow rotation and the held button
+			kRecordRelease = 1 << 1,   // start the grace period
+			kForgetButton = 1 << 2,    // stop listening to the held button
+			kClearFake = 1 << 3,       // release every fake button
+			kStartAttempt = 1 << 4,    // first fake fire press
+			kToggleAttempt = 1 << 5,   // flip the fake fire press
+			kCountFrame = 1 << 6,      // count a frame towards the next attempt
+			kStaminaFX = 1 << 7,       // play the stamina inhibitor effects
+			kBlockStamina = 1 << 8,    // latch the stamina block
+			kUnblockStamina = 1 << 9,  // release the stamina block
+		};
+	};
+
+	struct ArrowTransition
+	{
+		ArrowState next;
+		uint16_t   actions;
+	};
+
+	namespace detail
+	{
+		using TransitionTable = std::array<std::array<ArrowTransition, (size_t)ArrowInput::kCount>,
+			(size_t)ArrowState::kCount>;
+
+		constexpr TransitionTable BuildTransitions()
+		{
+			using S = ArrowState;
+			using I = ArrowInput;
+			using A = ArrowAction;
+
+			// anything not listed is ignored
+			TransitionTable table{};
+			for (size_t s = 0; s < table.size(); s++)
+			{
+				for (auto& t : table[s]) { t = { (S)s, A::kNone }; }
+			}
+			auto set = [&](S a_state, I a_input, S a_next, uint16_t a_actions) {
+				table[(size_t)a_state][(size_t)a_input] = { a_next, a_actions };
+			};
+
+			set(S::kIdle, I::kEquipWithButton, S::kArrowHeld, A::kCaptureArrow);
+			set(S::kIdle, I::kEquipNoButton, S::kIdle, A::kCaptureArrow);
+			set(S::kIdle, I::kButtonDownInGrace, S::kArrowHeld, A::kNone);
+			set(S::kIdle, I::kButtonDownLate, S::kIdle, A::kForgetButton);
+
+			set(S::kArrowHeld, I::kEquipWithButton, S::kArrowHeld, A::kCaptureArrow);
+			set(S::kArrowHeld, I::kEquipNoButton, S::kArrowHeld, A::kCaptureArrow);
+			set(S::kArrowHeld, I::kUnequip, S::kIdle, A::kClearFake);
+			set(S::kArrowHeld, I::kButtonUp, S::kIdle, A::kRecordRelease | A::kClearFake);
+			set(S::kArrowHeld, I::kOverlap, S::kTryToNock, A::kStartAttempt);
+			set(S::kArrowHeld, I::kOverlapLowStamina, S::kArrowHeld, A::kStaminaFX);
+			set(S::kArrowHeld, I::kOverlapLowStaminaLatch, S::kArrowHeld,
+				A::kStaminaFX | A::kBlockStamina);
+			set(S::kArrowHeld, I::kNoOverlap, S::kArrowHeld, A::kUnblockStamina);
+
+			set(S::kTryToNock, I::kButtonUp, S::kIdle, A::kClearFake);
+			set(S::kTryToNock, I::kNocked, S::kArrowNocked, A::kNone);
+			set(S::kTryToNock, I::kNoOverlap, S::kArrowHeld, A::kClearFake);
+			set(S::kTryToNock, I::kOverlap, S::kTryToNock, A::kCountFrame);
+			set(S::kTryToNock, I::kAttemptTick, S::kTryToNock, A::kCountFrame | A::kToggleAttempt);
+
+			set(S::kArrowNocked, I::kButtonUp, S::kIdle, A::kClearFake);
+
+			for (size_t s = 0; s < table.size(); s++)
+			{
+				set((S)s, I::kReset, S::kIdle,
+					A::kClearFake | A::kForgetButton | A::kUnblockStamina);
+			}
+
+			return table;
+		}
+	}
+
+	constexpr detail::TransitionTable kArrowTransitions = detail::BuildTransitions();
+
+	constexpr ArrowTransition NextTransition(ArrowState a_state, ArrowInput a_input)
+	{
+		return kArrowTransitions[(size_t)a_state][(size_t)a_input];
+	}
+
+	namespace detail
+	{
+		/* Abstract machine state for the model check: the table state plus the context the actions
+		* write that matters for the invariants
+		*/
+		struct ModelState
+		{
+			ArrowState state;
+			bool       fake_held;
+			bool       stamina_blocked;
+
+			constexpr size_t Index() const
+			{
+				return (size_t)state * 4 + fake_held * 2 + stamina_blocked;
+			}
+		};
+
+		constexpr ModelState ApplyModel(ModelState a_from, ArrowInput a_input)
+		{
+			auto [next, actions] = NextTransition(a_from.state, a_input);
+
+			bool fake = a_from.fake_held;
+			if (actions & ArrowAction::kStartAttempt) { fake = true; }
+			if (actions & ArrowAction::kToggleAttempt) { fake = !fake; }
+			if (actions & ArrowAction::kClearFake) { fake = false; }
+
+			bool blocked = a_from.stamina_blocked;
+			if (actions & ArrowAction::kBlockStamina) { blocked = true; }
+			if (actions & ArrowAction::kUnblockStamina) { blocked = false; }
+
+			return { next, fake, blocked };
+		}
+
+		/* Explores every state reachable from kIdle under every input sequence and checks the
+		* invariants on each reachable state and transition
+		*/
+		constexpr bool CheckArrowStateMachine()
+		{
+			constexpr size_t kModelStates = (size_t)ArrowState::kCount * 4;
+
+			std::array<bool, kModelStates>       reached{};
+			std::array<ModelState, kModelStates> queue{};
+			size_t                               head = 0, tail = 0;
+
+			queue[tail++] = { ArrowState::kIdle, false, false };
+			reached[queue[0].Index()] = true;
+
+			while (head < tail)
+			{
+				auto from = queue[head++];
+
+				// never leave a fake fire button held while idle
+				if (from.state == ArrowState::kIdle && from.fake_held) { return false; }
+
+				for (size_t i = 0; i < (size_t)ArrowInput::kCount; i++)
+				{
+					auto input = (ArrowInput)i;
+					auto [next, actions] = NextTransition(from.state, input);
+
+					// releasing the arrow button or a reset always ends up idle
+					if ((input == ArrowInput::kButtonUp || input == ArrowInput::kReset) &&
+						next != ArrowState::kIdle)
+					{
+						return false;
+					}
+					// nock attempts only start on entering kTryToNock and only run inside it
+					if (next == ArrowState::kTryToNock && from.state != ArrowState::kTryToNock &&
+						!(actions & ArrowAction::kStartAttempt))
+					{
+						return false;
+					}
+					if ((actions & (ArrowAction::kToggleAttempt | ArrowAction::kCountFrame)) &&
+						from.state != ArrowState::kTryToNock)
+					{
+						return false;
+					}
+					// an arrow only counts as nocked after an attempt
+					if (next == ArrowState::kArrowNocked &&
+						from.state != ArrowState::kArrowNocked &&
+						from.state != ArrowState::kTryToNock)
+					{
+						return false;
+					}
+					// a transition never both presses and releases the fake button
+					if ((actions & ArrowAction::kClearFake) &&
+						(actions & (ArrowAction::kStartAttempt | ArrowAction::kToggleAttempt)))
+					{
+						return false;
+					}
+
+					auto to = ApplyModel(from, input);
+					if (!reached[to.Index()])
+					{
+						reached[to.Index()] = true;
+						queue[tail++] = to;
+					}
+				}
+			}
+
+			// every state is reachable, so none of the table is dead
+			for (size_t s = 0; s < (size_t)ArrowState::kCount; s++)
+			{
+				if (!reached[s * 4] && !reached[s * 4 + 1] && !reached[s * 4 + 2] &&
+					!reached[s * 4 + 3])
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+
+	static_assert(detail::CheckArrowStateMachine(), "arrow state machine invariant violated");
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+/* Polynomial trig for per frame rotation math that does not need libm precision. Acos, Sin and Cos
+* below use these when built with the ENABLE_FAST_TRIG CMake option, the standard library otherwise.
+* Maximum absolute error in float, over every float of the domain in tests/fast_trig_bench.cpp:
+*   FastAcos [-1, 1]              6.8e-5 rad
+*   FastSin, FastCos [-8pi, 8pi]  3.7e-6
+*/
+namespace helper
+{
+	// sin on [-pi/2, pi/2], Taylor series to x^9, the next term bounds the error by 3.6e-6
+	inline float SinHalfPi(float x)
+	{
+		float x2 = x * x;
+		return x *
+			(1.f +
+				x2 * (-1.f / 6 + x2 * (1.f / 120 + x2 * (-1.f / 5040 + x2 * (1.f / 362880)))));
+	}
+
+	inline float FastSin(float x)
+	{
+		constexpr float kPi = std::numbers::pi_v<float>;
+
+		// reduce to [-pi, pi], then reflect into [-pi/2, pi/2] by sin(pi - x) == sin(x). Both steps
+		// are branch free, since the sign of a random angle is a coin flip to the branch predictor.
+		// Adding and subtracting 1.5 * 2^23 rounds to the nearest integer, where nearbyint is a
+		// libm call without SSE4.1 and a round trip through int stalls on the conversion
+		constexpr float kRound = 0x1.8p23f;
+		float           turns = x * (0.5f / kPi);
+		x -= 2 * kPi * ((turns + kRound) - kRound);
+		x = std::copysign(std::min(std::abs(x), kPi - std::abs(x)), x);
+		return SinHalfPi(x);
+	}
+
+	inline float FastCos(float x) { return FastSin(x + std::numbers::pi_v<float> / 2); }
+
+	// Abramowitz and Stegun 4.4.45
+	inline float FastAcos(float x)
+	{
+		float a = std::abs(x);
+		float r = std::sqrt(1.f - std::min(a, 1.f)) *
+			(1.5707288f + a * (-0.2121144f + a * (0.0742610f + a * -0.0187293f)));
+		return x < 0.f ? std::numbers::pi_v<float> - r : r;
+	}
+
+#ifdef ENABLE_FAST_TRIG
+	inline float Sin(float x) { return FastSin(x); }
+	inline float Cos(float x) { return FastCos(x); }
+	inline float Acos(float x) { return FastAcos(x); }
+#else
+	inline float Sin(float x) { return std::sin(x); }
+	inline float Cos(float x) { return std::cos(x); }
+	inline float Acos(float x) { return std::acos(x); }
+#endif
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "Windows.h"
+
+#include <filesystem>
+#include <functional>
+#include <thread>
+
+namespace helper
+{
+	/* Watches one file from a background thread and calls a_on_change on that thread whenever its
+	* last write time changes. Relies on directory change notifications, and also polls every
+	* kPollInterval in case notifications are unavailable (network drives) or missed.
+	*/
+	class FileWatcher
+	{
+	public:
+		using Callback = std::function<void(const std::filesystem::path&)>;
+
+		static constexpr auto kPollInterval = std::chrono::seconds(2);
+		// editors often write a file in several steps, wait for them to finish
+		static constexpr auto kSettleTime = std::chrono::milliseconds(100);
+
+		FileWatcher() = default;
+		~FileWatcher() { Stop(); }
+
+		FileWatcher(const FileWatcher&) = delete;
+		FileWatcher& operator=(const FileWatcher&) = delete;
+
+		void Start(std::filesystem::path a_path, Callback a_on_change);
+		void Stop();
+
+	private:
+		void Run();
+
+		std::filesystem::path           path;
+		Callback                        on_change;
+		std::filesystem::file_time_type last_write{};
+		std::thread                     worker;
+		HANDLE                          stop_event = nullptr;
+	};
+}
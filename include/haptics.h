@@ -0,0 +1,114 @@
+#pragma once
+#include "VR/openvr.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <thread>
+#include <vector>
+
+namespace haptics
+{
+	using Clock = std::chrono::steady_clock;
+	using Duration = std::chrono::microseconds;
+
+	// longest pulse OpenVR accepts, in microseconds
+	constexpr uint16_t kMaxPulse = 3999;
+
+	/* Immutable vibration pattern, played against the real clock so it feels the same at any refresh
+	* rate. Either a keyframe list or a parametric attack/sustain/release envelope. Keyframes are
+	* stored quantized to 16 us steps, one byte each.
+	*/
+	class Pattern
+	{
+	public:
+		/* a_keyframes: pulse lengths in microseconds, authored one per frame at a_keyframe_rate */
+		Pattern(std::initializer_list<uint16_t> a_keyframes, float a_keyframe_rate);
+
+		/* linear ramp up to a_peak, hold, then linear ramp down */
+		Pattern(uint16_t a_peak, Duration a_attack, Duration a_sustain, Duration a_release);
+
+		Duration Length() const { return length; }
+
+		/* returns the pulse length at a_time since the start, 0 past the end */
+		float Sample(Duration a_time) const;
+
+	private:
+		static constexpr int kQuantum = 16;
+
+		std::vector<uint8_t> samples;
+		Duration             period{};
+
+		uint16_t peak = 0;
+		Duration attack{};
+		Duration sustain{};
+		Duration release{};
+
+		Duration length{};
+	};
+
+	/* Starts a pattern on one hand, mixed with whatever is already playing there. a_pattern must
+	* outlive playback. If all voices of the hand are busy, the lowest priority one is replaced,
+	* unless it outranks the new pattern.
+	*/
+	void Play(bool isLeft, const Pattern& a_pattern, float a_power = 1.f, int a_priority = 0);
+
+	void Stop(bool isLeft);
+
+	/* Returns the summed pulse length of all voices of a hand at a_now, clamped to kMaxPulse. Pose
+	* thread only. Never waits on Play or Stop: when one holds the hand, the last mix is repeated
+	*/
+	uint16_t Mix(bool isLeft, Clock::time_point a_now);
+
+	/* Issues TriggerHapticPulse from its own thread so a slow driver call never stalls the frame.
+	* Requests are coalesced per hand: the longest pulse requested since the last dispatch is sent,
+	* no more often than the controller accepts them.
+	*/
+	class PulseDispatcher
+	{
+	public:
+		// OpenVR ignores pulses on the same controller and axis for 5ms after the previous one
+		static constexpr auto kPulseInterval = std::chrono::milliseconds(5);
+
+		static PulseDispatcher* GetSingleton()
+		{
+			static PulseDispatcher singleton;
+			return &singleton;
+		}
+
+		PulseDispatcher() = default;
+
+		// no join at DLL unload, where the loader lock is held and the worker may already be gone.
+		// Stop() is what shuts the worker down
+		~PulseDispatcher()
+		{
+			if (worker.joinable()) { worker.detach(); }
+		}
+
+		PulseDispatcher(const PulseDispatcher&) = delete;
+		PulseDispatcher& operator=(const PulseDispatcher&) = delete;
+
+		/* starts the worker, a_system can be any IVRSystem implementation */
+		void Start(vr::IVRSystem* a_system);
+		void Stop();
+
+		/* never blocks, safe to call from the compositor thread */
+		void Request(bool isLeft, vr::TrackedDeviceIndex_t a_device, uint16_t a_pulse);
+
+	private:
+		void Run();
+
+		struct PendingPulse
+		{
+			std::atomic<uint32_t> device = vr::k_unTrackedDeviceIndexInvalid;
+			std::atomic<uint16_t> pulse = 0;
+		};
+
+		vr::IVRSystem*        system = nullptr;
+		std::thread           worker;
+		std::atomic<bool>     running = false;
+		std::atomic<uint32_t> wake = 0;
+		PendingPulse          pending[2];
+	};
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+
+namespace helper
+{
+	/* One entry of an ini schema: the key, the member of the settings struct it fills and the
+	* accepted range for numbers. Defaults are the member initializers of the settings struct.
+	*/
+	template <typename S>
+	struct IniField
+	{
+		using Member = std::variant<bool S::*, int S::*, float S::*, std::string S::*>;
+
+		std::string_view key;
+		Member           member;
+		float            min = std::numeric_limits<float>::lowest();
+		float            max = std::numeric_limits<float>::max();
+	};
+
+	/* Fields of a schema sorted by key, built at compile time next to the schema so ApplyIni finds
+	* each key with a binary search. Duplicate keys fail to compile.
+	*/
+	template <typename S, size_t N>
+	struct IniIndex
+	{
+		consteval explicit IniIndex(const IniField<S> (&a_schema)[N])
+		{
+			for (size_t i = 0; i < N; i++) { sorted[i] = &a_schema[i]; }
+			std::ranges::sort(sorted, {}, &IniField<S>::key);
+			if (std::ranges::adjacent_find(sorted, {}, &IniField<S>::key) != sorted.end())
+			{
+				throw "duplicate ini key";
+			}
+		}
+
+		/* returns: the field of a_key, nullptr if there is none */
+		const IniField<S>* Find(std::string_view a_key) const
+		{
+			auto it = std::ranges::lower_bound(sorted, a_key, {}, &IniField<S>::key);
+			return it != sorted.end() && (*it)->key == a_key ? *it : nullptr;
+		}
+
+		std::array<const IniField<S>*, N> sorted{};
+	};
+
+	/* returns: the whole file, or nothing if it could not be read */
+	std::optional<std::string> ReadWholeFile(const std::filesystem::path& a_path);
+
+	/* Calls a_on_entry(key, value, line_number) for every "key = value" line of a_text, with both
+	* sides trimmed. Comment lines (# or ;), section headers and blank lines are skipped.
+	*/
+	template <typename F>
+	void ParseIni(std::string_view a_text, F&& a_on_entry)
+	{
+		constexpr std::string_view kWhitespace = " \t\r\n";
+
+		auto trim = [&](std::string_view a_s) {
+			auto first = a_s.find_first_not_of(kWhitespace);
+			if (first == std::string_view::npos) { return std::string_view(); }
+			return a_s.substr(first, a_s.find_last_not_of(kWhitespace) - first + 1);
+		};
+
+		int line_number = 0;
+		while (!a_text.empty())
+		{
+			auto end = a_text.find('\n');
+			auto line = trim(a_text.substr(0, end));
+			a_text.remove_prefix(end == std::string_view::npos ? a_text.size() : end + 1);
+			line_number++;
+
+			if (line.empty() || line[0] == '#' || line[0] == ';' || line[0] == '[') { continue; }
+
+			auto eq = line.find('=');
+			if (eq == std::string_view::npos) { continue; }
+
+			a_on_entry(trim(line.substr(0, eq)), trim(line.substr(eq + 1)), line_number);
+		}
+	}
+
+	/* Parses a number, allowing a trailing comment after whitespace */
+	template <typename T>
+	bool ParseIniNumber(std::string_view a_value, T& a_out)
+	{
+		auto [ptr, ec] = std::from_chars(a_value.data(), a_value.data() + a_value.size(), a_out);
+		if (ec != std::errc()) { return false; }
+		return ptr == a_value.data() + a_value.size() || *ptr == ' ' || *ptr == '\t' ||
+			*ptr == ';' || *ptr == '#';
+	}
+
+	/* Fills a_out from a_text in one pass over the lines. Keys missing from the text keep the value
+	* a_out already has; unknown keys, unparsable and out of range values are logged and ignored.
+	* returns: number of settings applied
+	*/
+	template <typename S, size_t N>
+	int ApplyIni(std::string_view a_text, const IniIndex<S, N>& a_schema, S& a_out)
+	{
+		int applied = 0;
+
+		ParseIni(a_text, [&](std::string_view a_key, std::string_view a_value, int a_line) {
+			auto field = a_schema.Find(a_key);
+			if (!field)
+			{
+				SKSE::log::warn("ini line {}: unknown setting '{}'", a_line, a_key);
+				return;
+			}
+
+			bool ok = std::visit(
+				[&](auto a_member) {
+					auto& target = a_out.*a_member;
+					using T = std::remove_cvref_t<decltype(target)>;
+
+					if constexpr (std::is_same_v<T, std::string>)
+					{
+						target = a_value;
+						return true;
+					}
+					else
+					{
+						// bools are written as 0/1 like the other integers
+						using Parsed = std::conditional_t<std::is_same_v<T, bool>, int, T>;
+						Parsed value{};
+						if (!ParseIniNumber(a_value, value) || value < field->min ||
+							value > field->max)
+						{
+							return false;
+						}
+						target = static_cast<T>(value);
+						return true;
+					}
+				},
+				field->member);
+
+			if (ok)
+			{
+				applied++;
+				SKSE::log::trace("{} : {}", a_key, a_value);
+			}
+			else
+			{
+				SKSE::log::warn("ini line {}: invalid value '{}' for {}, expected {} to {}", a_line,
+					a_value, a_key, field->min, field->max);
+			}
+		});
+
+		return applied;
+	}
+}
@@ -1,54 +1,199 @@
-#pragma once
-
-#include "SKSE/Impl/Stubs.h"
-#include "VR/OpenVRUtils.h"
-#include "VR/PapyrusVRAPI.h"
-#include "VR/VRManagerAPI.h"
-#include "menu_checker.h"
-#include "mod_event_sink.hpp"
-#include "vrinput.h"
-
-#define _DEBUGLOG(...) \
-	if (arrownock::g_debug_print) { SKSE::log::trace(__VA_ARGS__); }
-
-namespace arrownock
-{
-	constexpr const char* g_ini_path = "SKSE/Plugins/SeamlessArrowNocking.ini";
-
-	extern PapyrusVRAPI* g_papyrusvr;
-	extern bool          g_left_hand_mode;
-	extern bool          g_debug_print;
-
-	void Init();
-
-	void OnGameLoad();
-
-	void OnUpdate();
-
-	void OnMenuOpenClose(RE::MenuOpenCloseEvent const* evn);
-
-	void OnEquipped(const RE::TESEquipEvent* event);
-
-	bool OnButtonEvent(const vrinput::ModInputEvent& e);
-
-	bool IsOverlapping(float a_radius_squared);
-
-	bool IsArrowNocked();
-
-	void GetBowBaseAngle(RE::NiPoint3* out);
-
-	void TryNockArrow(bool a_start_spoof);
-
-	void PlayStaminaInhibitorFX();
-
-	/* true: player has enough stamina */
-	bool TestStamina(float a_threshold);
-
-	void UnregisterButtons(bool isLeft);
-	void RegisterButtons(bool isLeft);
-
-	void RegisterVRInputCallback();
-
-	/* returns: true if config file changed */
-	bool ReadConfig(const char* a_ini_path);
-}
+#pragma once
+
+#include "SKSE/Impl/Stubs.h"
+#include "VR/OpenVRUtils.h"
+#include "VR/PapyrusVRAPI.h"
+#include "VR/VRManagerAPI.h"
+#include "arrow_state.h"
+#include "file_watcher.h"
+#include "ini_reader.h"
+#include "menu_checker.h"
+#include "mod_event_sink.hpp"
+#include "profiler.h"
+#include "snapshot.h"
+#include "trace_log.h"
+#include "vrinput.h"
+
+#define _DEBUGLOG(...) \
+	if (arrownock::GetSettings()->ini.debug_level) { SKSE::log::trace(__VA_ARGS__); }
+
+// for the input and pose threads: Debug=1 logs right away, Debug=2 only records a binary trace event
+#define _DEBUGTRACE(a_event, ...)                                                      \
+	if (auto level = arrownock::GetSettings()->ini.debug_level)                          \
+	{                                                                                  \
+		tracelog::Trace(level == 2, tracelog::Event::a_event __VA_OPT__(, ) __VA_ARGS__); \
+	}
+
+namespace arrownock
+{
+	constexpr const char* g_ini_path = "SKSE/Plugins/SeamlessArrowNocking.ini";
+
+	/* Settings read from SeamlessArrowNocking.ini, see kIniSchema. Member initializers are the
+	* defaults used for keys missing from the file.
+	*/
+	struct IniSettings
+	{
+		bool        enable_nocking = true;
+		int         firebutton = vr::EVRButtonId::k_EButton_SteamVR_Trigger;
+		int         debug_level = 0;  // 1: log, 2: binary trace for the hot paths
+		int         grace_period_ms = 500;
+		float       stamina_threshold = 0.f;
+		bool        stamina_autorecover = true;
+		float       stamina_haptic_strength = 1.f;
+		int         stamina_visual_idx = 2;
+		std::string stamina_sound_editorID;
+		float       prediction_horizon_ms = 0.f;
+		bool        raw_pose_overlap = false;
+		int         profiler_interval_s = 0;  // only used by builds with ENABLE_PROFILER
+		float       nock_angle_threshold = 0.005f;  // radians of bow rotation that count as nocked
+		int         frames_between_attempts = 4;
+	};
+
+	// stamina inhibitor art objects, IniSettings::stamina_visual_idx is 1 based with 0 for none
+	constexpr std::array<RE::FormID, 2> kvisuals{ 0xabf02, 0x6b10f };
+
+	/* Key, IniSettings member and accepted range of every setting in the ini */
+	constexpr helper::IniField<IniSettings> kIniSchema[] = {
+		{ "iEnableAutonocking", &IniSettings::enable_nocking, 0, 1 },
+		{ "FireButtonID", &IniSettings::firebutton, 0, vr::k_EButton_Max - 1 },
+		{ "Debug", &IniSettings::debug_level, 0, 2 },
+		{ "iGracePeriod", &IniSettings::grace_period_ms, 0, 10000 },
+		{ "fStaminaThreshold", &IniSettings::stamina_threshold, 0.f, 100000.f },
+		{ "iAutonockAfterBlocking", &IniSettings::stamina_autorecover, 0, 1 },
+		{ "fHapticStrength", &IniSettings::stamina_haptic_strength, 0.f, 1.f },
+		{ "iVisualEffect", &IniSettings::stamina_visual_idx, 0, (float)kvisuals.size() },
+		{ "sBlockedSound", &IniSettings::stamina_sound_editorID },
+		{ "fPredictionHorizonMs", &IniSettings::prediction_horizon_ms, 0.f, 100.f },
+		{ "iRawPoseOverlap", &IniSettings::raw_pose_overlap, 0, 1 },
+		{ "iProfilerInterval", &IniSettings::profiler_interval_s, 0, 3600 },
+		{ "fNockAngleThreshold", &IniSettings::nock_angle_threshold, 0.0001f, 0.1f },
+		{ "iFramesBetweenAttempts", &IniSettings::frames_between_attempts, 1, 30 },
+	};
+	constexpr helper::IniIndex kIniIndex(kIniSchema);
+
+	/* Everything the nocking logic is configured with, replaced as a whole so no thread ever sees a
+	* half applied reload
+	*/
+	struct Settings
+	{
+		IniSettings ini;
+
+		// from the game's own ini
+		bool  left_hand_mode = false;
+		float overlap_radius = 18.f * 18.f;  // squared
+		float units_per_meter = 70.f;
+
+		bool  vrik_disabled = true;
+		// helper::QuatHalfAngleSinSq of two rotations ini.nock_angle_threshold apart
+		float nock_half_angle_sin_sq = helper::HalfAngleSinSq(IniSettings().nock_angle_threshold);
+	};
+
+	extern PapyrusVRAPI*      g_papyrusvr;
+	extern EpochPtr<Settings> g_settings;
+
+	/* Current settings. Callers on the input and pose threads must hold an EpochPtr::Guard on
+	* g_settings for as long as they use the result.
+	*/
+	inline const Settings* GetSettings() { return g_settings.Load(); }
+
+	void Init();
+
+	void OnGameLoad();
+
+	void OnUpdate();
+
+	void OnMenuOpenClose(RE::MenuOpenCloseEvent const* evn);
+
+	/* Object load event filter: the player's 3D was (re)loaded */
+	bool IsPlayerLoad(const RE::TESObjectLoadedEvent* event);
+
+	/* Drops the cached skeleton nodes, which the new 3D replaced */
+	void OnPlayerLoaded(const RE::TESObjectLoadedEvent* event);
+
+	/* Equip event filter: the player equipping or unequipping an arrow. OnEquipped never runs for
+	* NPCs or for anything else the player equips
+	*/
+	bool IsPlayerArrowEquip(const RE::TESEquipEvent* event);
+
+	/* Only receives the player's arrow equips */
+	void OnEquipped(const RE::TESEquipEvent* event);
+
+	bool OnButtonEvent(const vrinput::ModInputEvent& e);
+
+	/* Pose thread only. Looks up the transition for a_input from the current state, carries out its
+	* actions and moves to the next state. Does nothing while autonocking is off, except a kReset.
+	* a_button: the arrow button, stored when the transition captures the arrow
+	* a_settings: the frame's settings, loaded once by OnUpdate so a reload never lands mid frame
+	* a_time: when the input was observed
+	*/
+	void Dispatch(ArrowInput a_input, vr::EVRButtonId a_button, const Settings& a_settings,
+		std::chrono::steady_clock::time_point a_time = std::chrono::steady_clock::now());
+
+	/* From any thread: a_input is dispatched at the start of the next OnUpdate */
+	void QueueGameInput(ArrowInput a_input, vr::EVRButtonId a_button);
+
+	/* Overlap of the arrow hand and the bow from the scene graph, usable from any thread */
+	bool IsOverlapping(float a_radius_squared, const Settings& a_settings);
+
+	/* Pose thread only. Overlap from this frame's controller poses when raw pose overlap is enabled
+	* and calibrated, otherwise from the scene graph.
+	* a_horizon: seconds to extrapolate the arrow hand along its velocity relative to the bow hand,
+	* true if it enters the radius at any point until then
+	*/
+	bool IsOverlappingFromPoses(
+		float a_radius_squared, float a_horizon, const Settings& a_settings);
+
+	bool IsControllerStill(vrinput::Hand a_hand);
+
+	/* Pose thread only. Records where the arrow hand and arrow snap nodes sit relative to their
+	* controllers, taken from the scene graph
+	*/
+	void CalibratePoseOffsets(const Settings& a_settings);
+
+	bool IsArrowNocked(const Settings& a_settings);
+
+	/* Whether the game is drawing the bow, to tell real nocks from a bow hand that just turned */
+	bool IsDrawingBow();
+
+	/* Logs how long nocking took under a_settings since the last call, then clears the stats.
+	* Called before the tuning changes so every block of stats belongs to one tuning.
+	*/
+	void LogNockStats(const Settings& a_settings);
+
+	/* Rotation of the hand relative to the bow
+	* returns: false if the bow or hand node is missing, out is then left unchanged
+	*/
+	bool GetBowHandRotation(RE::NiQuaternion* out, const Settings& a_settings);
+
+	void TryNockArrow(bool a_start_spoof, const Settings& a_settings);
+
+	void PlayStaminaInhibitorFX(const Settings& a_settings);
+
+	/* true: player has enough stamina */
+	bool TestStamina(float a_threshold);
+
+	void UnregisterButtons(bool isLeft, vr::EVRButtonId a_firebutton);
+	void RegisterButtons(bool isLeft, vr::EVRButtonId a_firebutton);
+
+	/* Unregisters the button callbacks registered by the previous call and registers them for the
+	* new hand and fire button
+	*/
+	void RebindButtons(bool a_left_hand_mode, vr::EVRButtonId a_firebutton);
+
+	void RegisterVRInputCallback();
+
+	/* Debug chord: hold both grips for two seconds to dump the frame cost histograms */
+	bool OnProfilerChord(const vrinput::ModInputEvent& e);
+
+	/* Reads the game's own VR settings, rebinding buttons only if the handedness changed */
+	void ReadGameSettings();
+
+	/* Publishes new settings with a_ini, logging the values that differ from the current ones */
+	void ApplyIniSettings(const IniSettings& a_ini);
+
+	/* Called by the config watcher on its own thread */
+	void OnConfigFileChanged(const std::filesystem::path& a_path);
+
+	/* Initial load of the game settings and the config file. returns: true if the file was read */
+	bool ReadConfig(const char* a_ini_path);
+}
@@ -1,17 +1,65 @@
-// Shizof's method
-#pragma once
-
-#include <unordered_map>
-
-namespace menuchecker
-{
-	extern std::vector<std::string> gameStoppingMenus;
-
-	extern std::unordered_map<std::string, bool> menuTypes;
-
-	bool isGameStopped();
-
-	void begin();
-
-	void onMenuOpenClose(RE::MenuOpenCloseEvent const* evn);
-}
+// Shizof's method
+#pragma once
+
+#include <array>
+#include <string_view>
+
+namespace menuchecker
+{
+	struct TrackedMenu
+	{
+		std::string_view name;
+		bool             stops_game;
+	};
+
+	/* Every menu whose open state is tracked. A menu's ID is its index in this list */
+	constexpr std::array kTrackedMenus{ TrackedMenu{ "BarterMenu", true },
+		TrackedMenu{ "Book Menu", true }, TrackedMenu{ "Console", true },
+		TrackedMenu{ "Native UI Menu", true }, TrackedMenu{ "ContainerMenu", true },
+		TrackedMenu{ "Dialogue Menu", true }, TrackedMenu{ "Crafting Menu", true },
+		TrackedMenu{ "Credits Menu", true }, TrackedMenu{ "Cursor Menu", true },
+		TrackedMenu{ "Debug Text Menu", true }, TrackedMenu{ "Fader Menu", false },
+		TrackedMenu{ "FavoritesMenu", true }, TrackedMenu{ "GiftMenu", true },
+		TrackedMenu{ "HUD Menu", false }, TrackedMenu{ "InventoryMenu", true },
+		TrackedMenu{ "Journal Menu", true }, TrackedMenu{ "Kinect Menu", true },
+		TrackedMenu{ "Loading Menu", true }, TrackedMenu{ "Lockpicking Menu", true },
+		TrackedMenu{ "MagicMenu", true }, TrackedMenu{ "Main Menu", true },
+		TrackedMenu{ "MapMarkerText3D", true }, TrackedMenu{ "MapMenu", true },
+		TrackedMenu{ "MessageBoxMenu", true }, TrackedMenu{ "Mist Menu", true },
+		TrackedMenu{ "Overlay Interaction Menu", false }, TrackedMenu{ "Overlay Menu", false },
+		TrackedMenu{ "Quantity Menu", true }, TrackedMenu{ "RaceSex Menu", true },
+		TrackedMenu{ "Sleep/Wait Menu", true }, TrackedMenu{ "StatsMenu", false },
+		TrackedMenu{ "StatsMenuPerks", true }, TrackedMenu{ "StatsMenuSkillRing", true },
+		TrackedMenu{ "TitleSequence Menu", false }, TrackedMenu{ "Top Menu", false },
+		TrackedMenu{ "Training Menu", true }, TrackedMenu{ "Tutorial Menu", true },
+		TrackedMenu{ "TweenMenu", true }, TrackedMenu{ "WSEnemyMeters", false },
+		TrackedMenu{ "WSDebugOverlay", false }, TrackedMenu{ "WSActivateRollover", false },
+		TrackedMenu{ "LoadWaitSpinner", false } };
+
+	constexpr int kInvalidMenu = -1;
+
+	consteval int menuIDOf(std::string_view a_name)
+	{
+		for (int i = 0; i < (int)kTrackedMenus.size(); i++)
+		{
+			if (kTrackedMenus[i].name == a_name) { return i; }
+		}
+		throw "menu is not tracked";
+	}
+
+	constexpr int kJournalMenu = menuIDOf("Journal Menu");
+	constexpr int kRaceSexMenu = menuIDOf("RaceSex Menu");
+
+	/* Safe to call from any thread */
+	bool isGameStopped();
+
+	/* returns: ID of a menu name from a menu event, kInvalidMenu if it is not tracked. Only valid
+	* after begin()
+	*/
+	int getMenuID(const RE::BSFixedString& a_name);
+
+	/* Interns the tracked menu names and starts listening to menu events */
+	void begin();
+
+	void onMenuOpenClose(RE::MenuOpenCloseEvent const* evn);
+}
@@ -1,50 +1,90 @@
-// lets you add/remove callbacks to event sources at runtime... not sure why I thought I needed this
-#pragma once
-
-template <typename T>
-using EventCallback = void (*)(const T*);
-
-template <typename T>
-class EventSink : public RE::BSTEventSink<T>
-{
-public:
-	static EventSink* GetSingleton()
-	{
-		static EventSink singleton;
-		return &singleton;
-	}
-
-	void AddCallback(EventCallback<T> a_callback)
-	{
-		if (!a_callback) return;
-		std::scoped_lock lock(callback_lock);
-		callbacks.push_back(a_callback);
-	}
-
-	void RemoveCallback(EventCallback<T> a_callback)
-	{
-		if (!a_callback) return;
-		std::scoped_lock lock(callback_lock);
-
-		auto it = std::find(callbacks.begin(), callbacks.end(), a_callback);
-		if (it != callbacks.end()) { callbacks.erase(it); }
-	}
-
-private:
-	EventSink() = default;
-	~EventSink() = default;
-	EventSink(const EventSink&) = delete;
-	EventSink(EventSink&&) = delete;
-	EventSink& operator=(const EventSink&) = delete;
-	EventSink& operator=(EventSink&&) = delete;
-
-	RE::BSEventNotifyControl ProcessEvent(const T* a_event, RE::BSTEventSource<T>*)
-	{
-		std::scoped_lock lock(callback_lock);
-		for (auto callback : callbacks) callback(a_event);
-		return RE::BSEventNotifyControl::kContinue;
-	}
-
-	std::mutex                    callback_lock;
-	std::vector<EventCallback<T>> callbacks;
-};
+// lets you add/remove callbacks to event sources at runtime... not sure why I thought I needed this
+#pragma once
+
+#include "profiler.h"
+#include "snapshot.h"
+
+template <typename T>
+using EventCallback = void (*)(const T*);
+
+/* Runs before the callback of a subscription, which only sees events this returns true for */
+template <typename T>
+using EventFilter = bool (*)(const T*);
+
+template <typename T>
+class EventSink : public RE::BSTEventSink<T>
+{
+public:
+	static EventSink* GetSingleton()
+	{
+		static EventSink singleton;
+		return &singleton;
+	}
+
+	/* a_filter: optional, keep it cheap since it sees every event the game sends */
+	void AddCallback(EventCallback<T> a_callback, EventFilter<T> a_filter = nullptr)
+	{
+		if (!a_callback) return;
+		callbacks.Update(
+			[&](CallbackList& a_list) { a_list.push_back({ a_callback, a_filter }); });
+	}
+
+	void RemoveCallback(EventCallback<T> a_callback)
+	{
+		if (!a_callback) return;
+		callbacks.Update([&](CallbackList& a_list) {
+			auto it = std::find_if(a_list.begin(), a_list.end(),
+				[&](const Subscription& s) { return s.callback == a_callback; });
+			if (it != a_list.end()) { a_list.erase(it); }
+		});
+	}
+
+	/* number of callback calls made, and skipped because of a filter, since startup */
+	uint32_t Delivered() const { return delivered.load(std::memory_order_relaxed); }
+	uint32_t Filtered() const { return filtered.load(std::memory_order_relaxed); }
+
+private:
+	struct Subscription
+	{
+		EventCallback<T> callback;
+		EventFilter<T>   filter;
+	};
+	using CallbackList = std::vector<Subscription>;
+
+	EventSink() = default;
+	~EventSink() = default;
+	EventSink(const EventSink&) = delete;
+	EventSink(EventSink&&) = delete;
+	EventSink& operator=(const EventSink&) = delete;
+	EventSink& operator=(EventSink&&) = delete;
+
+	// lock free: iterates the list as it was when the event arrived, so callbacks may add or remove
+	// callbacks, which takes effect from the next event
+	RE::BSEventNotifyControl ProcessEvent(const T* a_event, RE::BSTEventSource<T>*)
+	{
+		PROFILE_SCOPE(kProcessEvent);
+
+		auto     list = callbacks.Read();
+		uint32_t skipped = 0;
+		for (auto& sub : *list)
+		{
+			if (sub.filter && !sub.filter(a_event))
+			{
+				skipped++;
+				continue;
+			}
+			sub.callback(a_event);
+		}
+		// counted once per event, an atomic add per callback cost more than the dispatch itself
+		if (skipped) { filtered.fetch_add(skipped, std::memory_order_relaxed); }
+		if (skipped < list->size())
+		{
+			delivered.fetch_add(uint32_t(list->size()) - skipped, std::memory_order_relaxed);
+		}
+		return RE::BSEventNotifyControl::kContinue;
+	}
+
+	Snapshot<CallbackList> callbacks;
+	std::atomic<uint32_t>  delivered = 0;
+	std::atomic<uint32_t>  filtered = 0;
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <array>
+
+namespace nodecache
+{
+	/* Player skeleton nodes used on the hot path */
+	enum class Node
+	{
+		kBow = 0,
+		kRightHand,
+		kLeftHand,
+		kLeftFinger,
+		kCount
+	};
+
+	constexpr std::array<const char*, (size_t)Node::kCount> kNodeNames{ "SHIELD",
+		"NPC R Hand [RHnd]", "NPC L Hand [LHnd]", "NPC L Finger10 [LF10]" };
+
+	/* Node under the player's first or third person root, looked up by name only the first time
+	* after the root changes or Invalidate() is called. Each thread keeps its own cache, so this is
+	* safe to call from the game, input and pose threads.
+	* returns: nullptr if the player has no 3D or the node does not exist (yet)
+	*/
+	RE::NiAVObject* Get(Node a_node, bool a_first_person);
+
+	/* Drops every thread's cached nodes. The cache holds plain pointers, so this must be called
+	* whenever the player's 3D is loaded or rebuilt
+	*/
+	void Invalidate();
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/* Frame cost histograms, built only with the ENABLE_PROFILER CMake option. Without it the macros
+* below expand to nothing and no timer code is compiled in.
+*/
+#ifdef ENABLE_PROFILER
+#	define PROFILER_CONCAT_IMPL(a, b) a##b
+#	define PROFILER_CONCAT(a, b) PROFILER_CONCAT_IMPL(a, b)
+#	define PROFILE_SCOPE(a_stage) \
+		profiler::ScopedTimer PROFILER_CONCAT(profile_scope_, __LINE__)(profiler::Stage::a_stage)
+#	define PROFILE_DUMP_EVERY(a_interval) profiler::DumpEvery(a_interval)
+#else
+#	define PROFILE_SCOPE(a_stage)
+#	define PROFILE_DUMP_EVERY(a_interval)
+#endif
+
+namespace profiler
+{
+	using Clock = std::chrono::steady_clock;
+
+	enum class Stage
+	{
+		kInputCallback = 0,
+		kPoseCallback,
+		kOnUpdate,
+		kOnButtonEvent,
+		kProcessEvent,
+		kCount
+	};
+
+	constexpr std::array<const char*, (size_t)Stage::kCount> kStageNames{ "ControllerInputCallback",
+		"ControllerPoseCallback", "OnUpdate", "OnButtonEvent", "EventSink::ProcessEvent" };
+
+	/* Lock free log-linear histogram of durations in nanoseconds: 16 linear buckets per power of two,
+	* so any percentile is accurate to about 6%. Any number of threads may record concurrently.
+	*/
+	class Histogram
+	{
+	public:
+		static constexpr int kSubBits = 4;
+		static constexpr int kSubBuckets = 1 << kSubBits;
+		static constexpr int kMaxExponent = 40;  // about 18 minutes
+		static constexpr int kBuckets = (kMaxExponent - kSubBits + 2) * kSubBuckets;
+
+		struct Summary
+		{
+			uint64_t count = 0;
+			uint64_t p50 = 0;
+			uint64_t p99 = 0;
+			uint64_t max = 0;
+		};
+
+		void Record(uint64_t a_ns)
+		{
+			buckets[BucketOf(a_ns)].fetch_add(1, std::memory_order_relaxed);
+
+			uint64_t current = max.load(std::memory_order_relaxed);
+			while (a_ns > current &&
+				!max.compare_exchange_weak(current, a_ns, std::memory_order_relaxed))
+			{}
+		}
+
+		/* Summarizes and clears. Samples recorded meanwhile land in this summary or the next one */
+		Summary TakeSummary();
+
+		static int BucketOf(uint64_t a_ns);
+
+		/* returns: smallest value that falls into a_bucket */
+		static uint64_t BucketFloor(int a_bucket);
+
+	private:
+		std::array<std::atomic<uint32_t>, kBuckets> buckets = {};
+		std::atomic<uint64_t>                       max = 0;
+	};
+
+	Histogram& GetHistogram(Stage a_stage);
+
+	class ScopedTimer
+	{
+	public:
+		explicit ScopedTimer(Stage a_stage) : stage(a_stage), start(Clock::now()) {}
+		~ScopedTimer()
+		{
+			GetHistogram(stage).Record(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+		}
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+	private:
+		Stage             stage;
+		Clock::time_point start;
+	};
+
+	/* Logs count, p50, p99 and max of every stage since the previous dump, then clears them */
+	void Dump();
+
+	/* Queues a Dump on the game thread once a_interval has passed since the last one. Cheap enough
+	* to call every frame; a zero interval disables it.
+	*/
+	void DumpEvery(std::chrono::seconds a_interval);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <span>
+
+/* Batched forms of Mat2Quat, Quat2Mat and QuatSlerp from helper_math.h, which stay the reference.
+* Each block of rotations is transposed to one rotation per SIMD lane, 4 with SSE2 and 8 when the
+* plugin is built with the ENABLE_AVX2 CMake option. Each output span must be at least as long as
+* the inputs. Swept against the scalar forms in tests/rotation_batch_test.cpp:
+*   Mat2QuatBatch   bit exact. Branchless with AVX2, with SSE2 that is slower so it calls Mat2Quat
+*   Quat2MatBatch   bit exact, 1 ulp of 1 where the compiler fuses multiply adds differently
+*   QuatSlerpBatch  2e-7, with its own trig accurate to float whether or not ENABLE_FAST_TRIG is set
+*/
+namespace helper
+{
+	void Mat2QuatBatch(
+		std::span<const RE::NiMatrix3> a_matrices, std::span<RE::NiQuaternion> a_out);
+
+	void Quat2MatBatch(std::span<const RE::NiQuaternion> a_quats, std::span<RE::NiMatrix3> a_out);
+
+	/* QuatSlerp(a_from[i], a_to[i], a_interp) for each i */
+	void QuatSlerpBatch(std::span<const RE::NiQuaternion> a_from,
+		std::span<const RE::NiQuaternion> a_to, float a_interp, std::span<RE::NiQuaternion> a_out);
+}
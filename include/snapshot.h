@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/* Reclamation schemes for Snapshot. Each tags a replaced version when it is retired and tells which
+* tags no reader can still be using:
+*   Pin Enter() / Exit(Pin)  reader side, nestable on one thread
+*   uint64_t Retire()        writer side, tag for the version just replaced
+*   uint64_t SafeTag()       writer side, retired versions with a tag up to this one can be freed
+*/
+
+/* One shared count of readers in flight. Entering is a single atomic add, but retired versions are
+* only freed by a publish that sees no reader at all, so steady reading can keep them around.
+*/
+class ReaderCount
+{
+public:
+	struct Pin
+	{};
+
+	Pin Enter() const
+	{
+		readers.fetch_add(1, std::memory_order_seq_cst);
+		return {};
+	}
+	void Exit(Pin) const { readers.fetch_sub(1, std::memory_order_release); }
+
+	uint64_t Retire() { return ++retired; }
+
+	// readers that pin after the exchange can only see the new version, so once none are in flight
+	// nothing can still reference a retired one
+	uint64_t SafeTag() const { return readers.load(std::memory_order_seq_cst) == 0 ? retired : 0; }
+
+private:
+	mutable std::atomic<uint32_t> readers = 0;
+	uint64_t                      retired = 0;  // writer only
+};
+
+/* Epoch based: a reader records the epoch it entered in, in a slot of its own thread, and a retired
+* version is freed once every thread that was inside at the time has left. Suits data that many
+* threads keep pinned most of the time. Up to kMaxThreads threads get a slot, past that reclamation
+* stops rather than risk freeing something in use.
+*/
+class EpochReclamation
+{
+public:
+	// threads that ever enter, a few more than the game's input, pose and main threads
+	static constexpr int kMaxThreads = 16;
+
+	using Pin = int;
+
+	Pin Enter() const
+	{
+		int slot = ThreadSlot();
+		if (slot < 0)
+		{
+			overflowed.store(true, std::memory_order_seq_cst);
+			return slot;
+		}
+		auto& reader = readers[slot];
+		if (reader.depth++ == 0)
+		{
+			reader.epoch.store(
+				global_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+		}
+		return slot;
+	}
+
+	void Exit(Pin a_slot) const
+	{
+		if (a_slot < 0) return;
+		auto& reader = readers[a_slot];
+		if (--reader.depth == 0) { reader.epoch.store(kInactive, std::memory_order_release); }
+	}
+
+	// a reader entering in this epoch or later can only load the new version
+	uint64_t Retire() { return global_epoch.fetch_add(1, std::memory_order_seq_cst) + 1; }
+
+	uint64_t SafeTag() const
+	{
+		if (overflowed.load(std::memory_order_seq_cst)) return 0;
+
+		uint64_t oldest = kInactive;
+		for (auto& reader : readers)
+		{
+			oldest = std::min(oldest, reader.epoch.load(std::memory_order_seq_cst));
+		}
+		return oldest;
+	}
+
+private:
+	static constexpr uint64_t kInactive = std::numeric_limits<uint64_t>::max();
+
+	// one cache line per thread so entering never contends with another reader
+	struct alignas(64) ReaderSlot
+	{
+		std::atomic<uint64_t> epoch = kInactive;
+		int                   depth = 0;  // only touched by the owning thread
+	};
+
+	/* returns: index of the calling thread, -1 once all slots are taken */
+	static int ThreadSlot()
+	{
+		static std::atomic<int> next_slot = 0;
+		thread_local int        slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+		return slot < kMaxThreads ? slot : -1;
+	}
+
+	std::atomic<uint64_t>     global_epoch = 0;
+	mutable ReaderSlot        readers[kMaxThreads];
+	mutable std::atomic<bool> overflowed = false;
+};
+
+/* Holds an immutable T that any thread can read without locking while other threads publish new
+* versions of it. Readers pin what they read with a Guard, or take a Reader (a Guard plus the
+* version current at the time). Replaced versions are kept until the reclamation scheme R says no
+* reader can still use them, so neither side ever waits, and code running under a Guard may itself
+* publish.
+* Load() outside a Guard is only safe on the publishing thread, and only until its next publish.
+*/
+template <typename T, typename R = ReaderCount>
+class Snapshot
+{
+public:
+	/* Keeps every version loaded while it is alive from being freed */
+	class Guard
+	{
+	public:
+		explicit Guard(const Snapshot& a_owner) : owner(a_owner), pin(a_owner.reclamation.Enter())
+		{}
+		~Guard() { owner.reclamation.Exit(pin); }
+
+		Guard(const Guard&) = delete;
+		Guard& operator=(const Guard&) = delete;
+
+	private:
+		const Snapshot&  owner;
+		typename R::Pin  pin;
+	};
+
+	class Reader
+	{
+	public:
+		explicit Reader(const Snapshot& a_owner) : guard(a_owner), data(a_owner.Load()) {}
+
+		const T* get() const { return data; }
+		const T* operator->() const { return data; }
+		const T& operator*() const { return *data; }
+
+	private:
+		Guard    guard;
+		const T* data;
+	};
+
+	Snapshot() : current(new T()) {}
+	~Snapshot() { delete current.load(); }
+
+	Snapshot(const Snapshot&) = delete;
+	Snapshot& operator=(const Snapshot&) = delete;
+
+	Reader Read() const { return Reader(*this); }
+
+	// sequentially consistent so a load can not move ahead of the Enter that pins it
+	const T* Load() const { return current.load(std::memory_order_seq_cst); }
+
+	/* Copies the current version, lets a_edit modify the copy and publishes the result. Writers are
+	* serialized so concurrent edits are never lost.
+	*/
+	template <typename F>
+	void Update(F&& a_edit)
+	{
+		std::scoped_lock lock(writer_lock);
+		auto             next = std::make_unique<T>(*current.load(std::memory_order_relaxed));
+		a_edit(*next);
+		PublishLocked(std::move(next));
+	}
+
+	void Publish(std::unique_ptr<T> a_next)
+	{
+		if (!a_next) return;
+		std::scoped_lock lock(writer_lock);
+		PublishLocked(std::move(a_next));
+	}
+
+	/* returns: replaced versions not freed yet */
+	size_t Retired() const
+	{
+		std::scoped_lock lock(writer_lock);
+		return retired.size();
+	}
+
+private:
+	struct RetiredVersion
+	{
+		std::unique_ptr<const T> data;
+		uint64_t                 tag;
+	};
+
+	void PublishLocked(std::unique_ptr<T> a_next)
+	{
+		const T* old = current.exchange(a_next.release(), std::memory_order_seq_cst);
+		retired.push_back({ std::unique_ptr<const T>(old), reclamation.Retire() });
+
+		uint64_t safe = reclamation.SafeTag();
+		std::erase_if(retired, [&](const RetiredVersion& r) { return r.tag <= safe; });
+	}
+
+	std::atomic<const T*>       current;
+	R                           reclamation;
+	mutable std::mutex          writer_lock;
+	std::vector<RetiredVersion> retired;
+};
+
+/* Snapshot for data that threads keep pinned across whole callbacks, like the settings */
+template <typename T>
+using EpochPtr = Snapshot<T, EpochReclamation>;
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/* Fixed capacity, allocation free queue for exactly one producer thread and one consumer thread.
+* When full, Push drops the new item and counts it instead of blocking or overwriting.
+*/
+template <typename T, size_t N>
+class SpscRing
+{
+	static_assert(N > 0 && (N & (N - 1)) == 0, "capacity must be a power of two");
+
+public:
+	static constexpr size_t kCapacity = N;
+
+	/* producer only. returns: false if the ring was full and a_item was dropped */
+	bool Push(const T& a_item)
+	{
+		size_t write = write_pos.load(std::memory_order_relaxed);
+		if (write - read_pos.load(std::memory_order_acquire) == N)
+		{
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		buffer[write & (N - 1)] = a_item;
+		write_pos.store(write + 1, std::memory_order_release);
+		return true;
+	}
+
+	/* consumer only. returns: false if the ring was empty */
+	bool Pop(T& a_out)
+	{
+		size_t read = read_pos.load(std::memory_order_relaxed);
+		if (read == write_pos.load(std::memory_order_acquire)) { return false; }
+		a_out = buffer[read & (N - 1)];
+		read_pos.store(read + 1, std::memory_order_release);
+		return true;
+	}
+
+	/* exact from the consumer thread, a hint from anywhere else */
+	bool Empty() const
+	{
+		return read_pos.load(std::memory_order_acquire) ==
+			write_pos.load(std::memory_order_acquire);
+	}
+
+	/* total number of items rejected by Push since startup */
+	uint32_t Dropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+	alignas(64) std::atomic<size_t> write_pos = 0;
+	alignas(64) std::atomic<size_t> read_pos = 0;
+	alignas(64) std::atomic<uint32_t> dropped = 0;
+	T buffer[N] = {};
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace tracelog
+{
+	/* Hot path log events. Each has a fixed format, so a record only stores the id and the args */
+	enum class Event : uint16_t
+	{
+		kStateChange = 0,
+		kArrowButton,
+		kArrowHoldResumed,
+		kPredictionMissed,
+		kIsArrowNocked,
+		kFakeFireRelease,
+		kFakeFireDown,
+		kClearFake,
+		kUnbentRotation,
+		kFXRateLimit,
+		kCount
+	};
+
+	constexpr std::array<std::string_view, (size_t)Event::kCount> kEventFormats{
+		"STATE CHANGE:  {} to {}",
+		"arrow button {} event, pressed: {}",
+		"Arrow button holding resumed after {} ms",
+		"predicted overlap missed, {} so far",
+		"IsArrowNocked: {}",
+		"sending fake input: momentary fire button release. current state: {}",
+		"sending fake input: fire button down",
+		"clearing fake button states",
+		"Got unbent rotation: {} {} {} {}",
+		"FX rate limit",
+	};
+
+	constexpr size_t kMaxArgs = 4;
+
+	/* Fixed size binary record, formatted later on the writer thread */
+	struct Record
+	{
+		uint64_t timestamp_ns = 0;
+		Event    event = Event::kCount;
+		uint8_t  argc = 0;
+		double   args[kMaxArgs] = {};
+	};
+
+	/* Appends a record to the calling thread's ring without blocking. If the ring is full the
+	* record is dropped and counted.
+	*/
+	void Write(const Record& a_record);
+
+	/* Formats a record the same way the writer thread does */
+	std::string Format(const Record& a_record);
+
+	uint64_t Now();
+
+	/* Builds a record from up to kMaxArgs numeric arguments, then either writes it to the trace
+	* ring (a_async) or formats and logs it right away
+	*/
+	template <typename... Args>
+	void Trace(bool a_async, Event a_event, Args... a_args)
+	{
+		static_assert(sizeof...(Args) <= kMaxArgs, "too many trace arguments");
+
+		Record record{ Now(), a_event, (uint8_t)sizeof...(Args), { (double)a_args... } };
+		if (a_async) { Write(record); }
+		else { SKSE::log::trace("{}", Format(record)); }
+	}
+
+	/* Starts the thread that drains the rings to the log every few milliseconds */
+	void Start();
+	void Stop();
+
+	/* total number of records dropped because a ring was full or there were too many threads */
+	uint64_t Dropped();
+}
@@ -0,0 +1,71 @@
+#include "file_watcher.h"
+
+namespace helper
+{
+	void FileWatcher::Start(std::filesystem::path a_path, Callback a_on_change)
+	{
+		if (worker.joinable()) return;
+
+		path = std::move(a_path);
+		on_change = std::move(a_on_change);
+
+		std::error_code ec;
+		last_write = std::filesystem::last_write_time(path, ec);
+
+		stop_event = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+		if (!stop_event)
+		{
+			SKSE::log::error("could not create file watcher for {}", path.string());
+			return;
+		}
+		worker = std::thread(&FileWatcher::Run, this);
+	}
+
+	void FileWatcher::Stop()
+	{
+		if (!worker.joinable()) return;
+
+		SetEvent(stop_event);
+		worker.join();
+		CloseHandle(stop_event);
+		stop_event = nullptr;
+	}
+
+	void FileWatcher::Run()
+	{
+		HANDLE change = FindFirstChangeNotificationW(path.parent_path().c_str(), FALSE,
+			FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+		if (change == INVALID_HANDLE_VALUE)
+		{
+			SKSE::log::warn("change notifications unavailable for {}, polling instead",
+				path.parent_path().string());
+			change = nullptr;
+		}
+
+		HANDLE     handles[2] = { stop_event, change };
+		const auto poll_ms = (DWORD)std::chrono::milliseconds(kPollInterval).count();
+		const auto settle_ms = (DWORD)kSettleTime.count();
+
+		while (true)
+		{
+			DWORD wait = WaitForMultipleObjects(change ? 2 : 1, handles, FALSE, poll_ms);
+			if (wait == WAIT_OBJECT_0) { break; }
+
+			if (change && wait == WAIT_OBJECT_0 + 1)
+			{
+				if (WaitForSingleObject(stop_event, settle_ms) == WAIT_OBJECT_0) { break; }
+				FindNextChangeNotification(change);
+			}
+
+			std::error_code ec;
+			auto            write = std::filesystem::last_write_time(path, ec);
+			if (!ec && write != last_write)
+			{
+				last_write = write;
+				on_change(path);
+			}
+		}
+
+		if (change) { FindCloseChangeNotification(change); }
+	}
+}
@@ -0,0 +1,179 @@
+#include "haptics.h"
+
+namespace haptics
+{
+	Pattern::Pattern(std::initializer_list<uint16_t> a_keyframes, float a_keyframe_rate)
+	{
+		period = Duration((int64_t)(1'000'000.f / std::max(a_keyframe_rate, 1.f)));
+		length = period * (int64_t)a_keyframes.size();
+
+		samples.reserve(a_keyframes.size());
+		for (auto k : a_keyframes)
+		{
+			samples.push_back(
+				(uint8_t)((std::min(k, kMaxPulse) + kQuantum / 2) / kQuantum));
+		}
+	}
+
+	Pattern::Pattern(uint16_t a_peak, Duration a_attack, Duration a_sustain, Duration a_release) :
+		peak(std::min(a_peak, kMaxPulse)),
+		attack(a_attack),
+		sustain(a_sustain),
+		release(a_release),
+		length(a_attack + a_sustain + a_release)
+	{}
+
+	float Pattern::Sample(Duration a_time) const
+	{
+		if (a_time < Duration::zero() || a_time >= length) { return 0.f; }
+
+		if (!samples.empty())
+		{
+			// interpolate between keyframes
+			auto  index = (size_t)(a_time / period);
+			float frac = (float)(a_time % period).count() / period.count();
+			float a = samples[index];
+			float b = index + 1 < samples.size() ? samples[index + 1] : 0.f;
+			return (a + (b - a) * frac) * kQuantum;
+		}
+
+		if (a_time < attack) { return peak * ((float)a_time.count() / attack.count()); }
+		a_time -= attack;
+		if (a_time < sustain) { return peak; }
+		a_time -= sustain;
+		return peak * (1.f - (float)a_time.count() / release.count());
+	}
+
+	struct Voice
+	{
+		const Pattern*    pattern = nullptr;
+		Clock::time_point start;
+		float             power = 0.f;
+		int               priority = 0;
+	};
+
+	constexpr size_t kVoicesPerHand = 4;
+
+	struct HandMixer
+	{
+		std::mutex                        lock;
+		std::array<Voice, kVoicesPerHand> voices;
+		uint16_t                          last_mix = 0;  // pose thread only
+	};
+
+	HandMixer mixers[2];
+
+	void Play(bool isLeft, const Pattern& a_pattern, float a_power, int a_priority)
+	{
+		auto& mixer = mixers[isLeft];
+
+		std::scoped_lock lock(mixer.lock);
+
+		// free voice, otherwise the lowest priority one
+		Voice* target = &mixer.voices[0];
+		for (auto& voice : mixer.voices)
+		{
+			if (!voice.pattern)
+			{
+				target = &voice;
+				break;
+			}
+			if (voice.priority < target->priority) { target = &voice; }
+		}
+		if (target->pattern && target->priority > a_priority) { return; }
+
+		*target = { &a_pattern, Clock::now(), std::clamp(a_power, 0.f, 1.f), a_priority };
+	}
+
+	void Stop(bool isLeft)
+	{
+		auto& mixer = mixers[isLeft];
+
+		std::scoped_lock lock(mixer.lock);
+		mixer.voices.fill({});
+	}
+
+	uint16_t Mix(bool isLeft, Clock::time_point a_now)
+	{
+		auto& mixer = mixers[isLeft];
+
+		// skip the frame rather than stall the pose thread behind the game thread
+		std::unique_lock lock(mixer.lock, std::try_to_lock);
+		if (!lock) { return mixer.last_mix; }
+
+		float sum = 0.f;
+		for (auto& voice : mixer.voices)
+		{
+			if (!voice.pattern) { continue; }
+
+			auto elapsed = std::chrono::duration_cast<Duration>(a_now - voice.start);
+			if (elapsed >= voice.pattern->Length())
+			{
+				voice = {};
+				continue;
+			}
+			sum += voice.pattern->Sample(elapsed) * voice.power;
+		}
+		mixer.last_mix = (uint16_t)std::clamp(sum, 0.f, (float)kMaxPulse);
+		return mixer.last_mix;
+	}
+
+	void PulseDispatcher::Start(vr::IVRSystem* a_system)
+	{
+		if (!a_system || running.exchange(true)) return;
+
+		system = a_system;
+		worker = std::thread(&PulseDispatcher::Run, this);
+	}
+
+	void PulseDispatcher::Stop()
+	{
+		if (!running.exchange(false)) return;
+
+		wake.fetch_add(1, std::memory_order_release);
+		wake.notify_one();
+		if (worker.joinable()) { worker.join(); }
+	}
+
+	void PulseDispatcher::Request(bool isLeft, vr::TrackedDeviceIndex_t a_device, uint16_t a_pulse)
+	{
+		if (!a_pulse) return;
+
+		auto& slot = pending[isLeft];
+		slot.device.store(a_device, std::memory_order_relaxed);
+
+		// keep the longest pulse until the worker picks it up
+		uint16_t current = slot.pulse.load(std::memory_order_relaxed);
+		while (current < a_pulse &&
+			!slot.pulse.compare_exchange_weak(current, a_pulse, std::memory_order_release))
+		{}
+
+		wake.fetch_add(1, std::memory_order_release);
+		wake.notify_one();
+	}
+
+	void PulseDispatcher::Run()
+	{
+		uint32_t seen = 0;
+
+		while (running.load(std::memory_order_acquire))
+		{
+			// sleep until there is something to send
+			wake.wait(seen, std::memory_order_acquire);
+			seen = wake.load(std::memory_order_acquire);
+
+			auto sent_at = Clock::now();
+
+			for (auto& slot : pending)
+			{
+				if (auto pulse = slot.pulse.exchange(0, std::memory_order_acquire))
+				{
+					system->TriggerHapticPulse(
+						slot.device.load(std::memory_order_relaxed), 0, pulse);
+				}
+			}
+
+			std::this_thread::sleep_until(sent_at + kPulseInterval);
+		}
+	}
+}
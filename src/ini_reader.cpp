@@ -0,0 +1,15 @@
+#include "ini_reader.h"
+
+namespace helper
+{
+	std::optional<std::string> ReadWholeFile(const std::filesystem::path& a_path)
+	{
+		std::ifstream file(a_path, std::ios::binary | std::ios::ate);
+		if (!file.is_open()) { return std::nullopt; }
+
+		std::string contents(static_cast<size_t>(file.tellg()), '\0');
+		file.seekg(0);
+		if (!file.read(contents.data(), contents.size())) { return std::nullopt; }
+		return contents;
+	}
+}
@@ -1,599 +1,948 @@
-#include "main_plugin.h"
-
-#include <chrono>
-
-namespace arrownock
-{
-	enum class ArrowState
-	{
-		// No arrow equipped or no buttons held
-		kIdle = 0,
-		// An arrow has been equipped and we are waiting for it to overlap with the bow
-		kArrowHeld,
-		// Arrow button is held down and the arrow was brought to the bow, now we are trying to nock it
-		kTryToNock,
-		// Arrow was nocked successfully, just waiting for button to be released
-		kArrowNocked
-	};
-
-	constexpr std::array kCheckButtons{ vr::k_EButton_SteamVR_Trigger, vr::k_EButton_A,
-		vr::k_EButton_Knuckles_B, vr::k_EButton_SteamVR_Touchpad, vr::k_EButton_Grip };
-
-	PapyrusVRAPI* g_papyrusvr;
-
-	// user settings, documented in .ini
-	bool            g_enable_nocking = true;
-	bool            g_stamina_autorecover = true;
-	bool            g_debug_print = false;
-	vr::EVRButtonId g_firebutton = vr::EVRButtonId::k_EButton_SteamVR_Trigger;
-	int             g_grace_period_ms = 500;
-	float           g_stamina_threshold = 0.f;
-	float           g_stamina_haptic_strength = 1.f;
-	int             g_stamina_visual_idx = 2;
-	std::string     g_stamina_sound_editorID;
-
-	// settings
-	bool              g_left_hand_mode = false;
-	float             g_overlap_radius = 18.f;
-	float             g_angle_diff_threshold = 0.005f;
-	int               g_frames_between_attempts = 4;
-	bool              g_vrik_disabled = true;
-	RE::BSSoundHandle g_stamina_sound;
-
-	// state
-	ArrowState      g_state = ArrowState::kIdle;
-	RE::NiPoint3    g_unbent_bow_angle;
-	vr::EVRButtonId g_arrow_held_button = vr::EVRButtonId::k_EButton_Max;
-
-	// resources
-	constexpr std::array<RE::FormID, 2> kvisuals{ 0xabf02, 0x6b10f };
-	std::vector<uint16_t> khaptic_keyframes = { 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875,
-		3875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3875, 3875, 3875, 3875, 3875, 3875, 3875,
-		3875, 3875, 3750, 3625, 3500, 3250, 2875, 2375, 2000, 1625, 1250, 1000, 750, 625, 375, 375,
-		250, 125, 125 };
-
-	inline void StateTransition(ArrowState a_next_state)
-	{
-		if (g_enable_nocking)
-		{
-			_DEBUGLOG("STATE CHANGE:  {} to {}", (int)g_state, (int)a_next_state);
-			g_state = a_next_state;
-		}
-	}
-
-	void Init()
-	{
-		g_vrik_disabled = GetModuleHandleA("vrik") == NULL;
-		SKSE::log::info("VRIK {} found", g_vrik_disabled ? "not" : "DLL");
-
-		ReadConfig(g_ini_path);
-
-		auto equip_sink = EventSink<RE::TESEquipEvent>::GetSingleton();
-		equip_sink->AddCallback(OnEquipped);
-		RE::ScriptEventSourceHolder::GetSingleton()->AddEventSink(equip_sink);
-
-		auto menu_sink = EventSink<RE::MenuOpenCloseEvent>::GetSingleton();
-		menu_sink->AddCallback(OnMenuOpenClose);
-		RE::UI::GetSingleton()->AddEventSink(menu_sink);
-
-		menuchecker::begin();
-		RegisterVRInputCallback();
-	}
-
-	void OnGameLoad()
-	{
-		_DEBUGLOG("Load Game: reset state");
-		g_state = ArrowState::kIdle;
-		g_arrow_held_button = vr::EVRButtonId::k_EButton_Max;
-	}
-
-	void OnMenuOpenClose(RE::MenuOpenCloseEvent const* evn)
-	{
-		if (!evn->opening && std::strcmp(evn->menuName.data(), "Journal Menu") == 0)
-		{
-			ReadConfig(g_ini_path);
-		}
-	}
-
-	void OnEquipped(const RE::TESEquipEvent* event)
-	{
-		if (event && event->actor && event->actor.get() == RE::PlayerCharacter::GetSingleton() &&
-			!menuchecker::isGameStopped())
-		{
-			switch (g_state)
-			{
-			case ArrowState::kIdle:
-			case ArrowState::kArrowHeld:
-				// is object an arrow
-				if (auto form = RE::TESForm::LookupByID(event->baseObject);
-					form && form->IsAmmo() && !form->As<RE::TESAmmo>()->IsBolt())
-				{
-					if (event->equipped)
-					{
-						// does player have bow equipped
-						if (auto weap = RE::PlayerCharacter::GetSingleton()->GetEquippedObject(
-								!g_left_hand_mode);
-							weap && weap->IsWeapon() && weap->As<RE::TESObjectWEAP>()->IsBow())
-						{
-							// get the bow angle when no arrow is nocked
-							GetBowBaseAngle(&g_unbent_bow_angle);
-							_DEBUGLOG("Got unbent angle: {} {} {}", VECTOR((g_unbent_bow_angle)));
-
-							g_arrow_held_button = vr::k_EButton_Max;
-
-							// Only one button is chosen, ordered by increasing likelihood of accidental
-							// button press
-							for (auto b : kCheckButtons)
-							{
-								if (vrinput::GetButtonState(b, (vrinput::Hand)g_left_hand_mode,
-										vrinput::ActionType::kPress) ==
-									vrinput::ButtonState::kButtonDown)
-								{
-									g_arrow_held_button = b;
-
-									_DEBUGLOG("arrow equipped with button press: {}",
-										g_arrow_held_button);
-
-									StateTransition(ArrowState::kArrowHeld);
-									return;
-								}
-							}
-						}
-					}
-					else
-					{  // arrow was unequipped, go to idle state
-						StateTransition(ArrowState::kIdle);
-					}
-				}
-				break;
-			default:
-				break;
-			}
-		}
-	}
-
-	bool OnButtonEvent(const vrinput::ModInputEvent& e)
-	{
-		static std::chrono::steady_clock::time_point last_arrow_hold = {};
-
-		if (e.button_ID == g_arrow_held_button)
-		{
-			_DEBUGLOG("arrow button {} event {}",
-				e.button_state == vrinput::ButtonState::kButtonUp ? "release" : "press",
-				e.button_ID);
-
-			if (e.button_state == vrinput::ButtonState::kButtonUp)
-			{
-				switch (g_state)
-				{
-				case ArrowState::kIdle:
-					break;
-				case ArrowState::kArrowHeld:
-					last_arrow_hold = std::chrono::steady_clock::now();
-				case ArrowState::kTryToNock:
-				case ArrowState::kArrowNocked:
-				default:
-					vrinput::ClearAllFake();
-					StateTransition(ArrowState::kIdle);
-					break;
-				}
-			}
-			else  // button down
-			{
-				switch (g_state)
-				{
-				case ArrowState::kIdle:
-					{
-						// Check if we're still in the grace period
-						auto ms_since_release =
-							std::chrono::duration_cast<std::chrono::milliseconds>(
-								std::chrono::steady_clock::now() - last_arrow_hold)
-								.count();
-
-						if (ms_since_release < g_grace_period_ms)
-						{
-							_DEBUGLOG("Arrow button holding resumed after {} ms", ms_since_release);
-							StateTransition(ArrowState::kArrowHeld);
-						}
-						else
-						{
-							// too late, stop listening to this button
-							g_arrow_held_button = vr::EVRButtonId::k_EButton_Max;
-						}
-					}
-				default:
-					break;
-				}
-			}
-		}
-
-		// Stamina Inhibitor Feature - manual nocking
-		if (e.button_ID == g_firebutton && e.button_state == vrinput::ButtonState::kButtonDown &&
-			g_stamina_threshold > 0.f)
-		{
-			if (!TestStamina(g_stamina_threshold))
-			{
-				if (auto weap =
-						RE::PlayerCharacter::GetSingleton()->GetEquippedObject(!g_left_hand_mode);
-					weap && weap->IsWeapon() && weap->As<RE::TESObjectWEAP>()->IsBow())
-				{
-					if (auto ammo = RE::PlayerCharacter::GetSingleton()->GetCurrentAmmo();
-						ammo && !ammo->IsBolt())
-					{
-						if (IsOverlapping(arrownock::g_overlap_radius * 1.05))
-						{
-							// Player is attemping to fire a bow with not enough stamina, block the trigger press
-							PlayStaminaInhibitorFX();
-							return true;
-						}
-					}
-				}
-			}
-		}
-
-		return false;
-	}
-
-	void OnUpdate()
-	{
-		static bool fake_button_down = false;
-		static int  frame_count = 0;
-
-		switch (g_state)
-		{
-		case ArrowState::kIdle:
-			break;
-		case ArrowState::kArrowHeld:
-			{
-				static bool stamina_blocked = false;
-				if (IsOverlapping(g_overlap_radius * 0.95))
-				{
-					if (!stamina_blocked)
-					{
-						// Stamina Inhibitor Feature: block auto nocking
-						if (g_stamina_threshold > 0.f && !TestStamina(g_stamina_threshold))
-						{
-							// Player is attemping to fire a bow with not enough stamina
-							PlayStaminaInhibitorFX();
-
-							// Set the flag that indicates player must move out of overlap zone to reset the stamina block
-							if (!g_stamina_autorecover) { stamina_blocked = true; }
-						}
-						else
-						{
-							fake_button_down = true;
-							frame_count = 0;
-							TryNockArrow(true);
-							StateTransition(ArrowState::kTryToNock);
-						}
-					}
-				}
-				// stamina inhibitor: unblock autonocking when player moves out of overlap zone,
-				// even if stamina has not recovered we'll check it again and repeat the FX next
-				// time they try
-				else if (stamina_blocked) { stamina_blocked = false; }
-
-				break;
-			}
-		case ArrowState::kTryToNock:
-			if (IsArrowNocked()) { StateTransition(ArrowState::kArrowNocked); }
-			else if (!IsOverlapping(g_overlap_radius * 0.95))
-			{
-				StateTransition(ArrowState::kArrowHeld);
-			}
-			else if (++frame_count % g_frames_between_attempts == 0)
-			{
-				fake_button_down ^= 1;
-				TryNockArrow(fake_button_down);
-			}
-
-			break;
-		default:
-			break;
-		}
-	}
-
-	bool IsOverlapping(float a_radius_squared)
-	{
-		if (auto pcvr = RE::PlayerCharacter::GetSingleton()->GetVRNodeData())
-		{
-			// compute overlap
-			auto bow_node = pcvr->ArrowSnapNode;
-			auto arrow_node = g_left_hand_mode ? pcvr->LeftWandNode : pcvr->RightWandNode;
-
-			return (arrow_node->world.translate - bow_node->world.translate).SqrLength() <
-				a_radius_squared;
-		}
-		return false;
-	}
-
-	/* Get the angle between the bow and the hand, normally fixed but any change indicates arrow is in place */
-	void GetBowBaseAngle(RE::NiPoint3* out)
-	{
-		if (auto pc = RE::PlayerCharacter::GetSingleton(); pc && pc->Get3D(g_vrik_disabled))
-		{
-			auto bow = pc->Get3D(g_vrik_disabled)->GetObjectByName("SHIELD")->world;
-			auto hand =
-				vrinput::GetHandNode((vrinput::Hand)!g_left_hand_mode, g_vrik_disabled)->world;
-
-			auto rotdiff = bow.rotate.Transpose() * hand.rotate;
-			rotdiff.ToEulerAnglesXYZ(*out);
-		}
-	}
-
-	/* Checks if the current hand-bow angle is different from the base */
-	bool IsArrowNocked()
-	{
-		if (auto pc = RE::PlayerCharacter::GetSingleton(); pc && pc->Get3D(g_vrik_disabled))
-		{
-			RE::NiPoint3 ang;
-			GetBowBaseAngle(&ang);
-
-			ang = g_unbent_bow_angle - ang;
-
-			auto norm = std::sqrt(ang.x * ang.x + ang.y * ang.y + ang.z * ang.z);
-			_DEBUGLOG("IsArrowNocked: {}", norm);
-			return norm > g_angle_diff_threshold;
-		}
-		return false;
-	}
-
-	void TryNockArrow(bool a_start_spoof)
-	{
-		if (a_start_spoof)
-		{
-			if (g_arrow_held_button == g_firebutton)
-			{
-				auto isfiredown = vrinput::GetButtonState(
-					g_arrow_held_button, vrinput::Hand::kRight, vrinput::ActionType::kPress);
-				_DEBUGLOG("sending fake input: momentary fire button release. current state: {}",
-					(bool)isfiredown)
-				vrinput::SendFakeInputEvent(
-					{ .device = g_left_hand_mode ? vrinput::Hand::kLeft : vrinput::Hand::kRight,
-						.touch_or_press = vrinput::ActionType::kPress,
-						.button_state = vrinput::ButtonState::kButtonUp,
-						.button_ID = g_firebutton });
-			}
-			else
-			{
-				_DEBUGLOG("sending fake input: fire button down")
-				vrinput::SetFakeButtonState({
-					.device = g_left_hand_mode ? vrinput::Hand::kLeft : vrinput::Hand::kRight,
-					.touch_or_press = vrinput::ActionType::kPress,
-					.button_state = vrinput::ButtonState::kButtonDown,
-					.button_ID = g_firebutton,
-				});
-				vrinput::SetFakeButtonState({
-					.device = g_left_hand_mode ? vrinput::Hand::kLeft : vrinput::Hand::kRight,
-					.touch_or_press = vrinput::ActionType::kTouch,
-					.button_state = vrinput::ButtonState::kButtonDown,
-					.button_ID = g_firebutton,
-				});
-			}
-		}
-		else
-		{  // reset button so we can try again in a few frames
-			if (g_arrow_held_button != g_firebutton)
-			{
-				_DEBUGLOG("clearing fake button states")
-				vrinput::ClearAllFake();
-			}
-		}
-	}
-
-	void PlayStaminaInhibitorFX()
-	{
-		constexpr int kMinFXInterval = 1400;
-
-		static std::chrono::steady_clock::time_point last_played = {};
-
-		auto now = std::chrono::steady_clock::now();
-
-		if (std::chrono::duration_cast<std::chrono::milliseconds>(now - last_played).count() >
-			kMinFXInterval)
-		{
-			last_played = now;
-
-			_DEBUGLOG("Bow draw blocked, stamina: {} ({}%) ",
-				RE::PlayerCharacter::GetSingleton()->AsActorValueOwner()->GetActorValue(
-					RE::ActorValue::kStamina),
-				helper::GetAVPercent(
-					RE::PlayerCharacter::GetSingleton(), RE::ActorValue::kStamina));
-
-			auto pc = RE::PlayerCharacter::GetSingleton();
-			auto node = pc->Get3D(g_vrik_disabled)->GetObjectByName("NPC L Finger10 [LF10]");
-
-			// Controller vibration
-			if (g_stamina_haptic_strength > 0.f)
-			{
-				_DEBUGLOG("Activating haptics");
-				vrinput::Vibrate(!g_left_hand_mode, &khaptic_keyframes, g_stamina_haptic_strength);
-			}
-			// Sound Effect
-			if (!g_stamina_sound_editorID.empty() &&
-				std::strcmp(g_stamina_sound_editorID.c_str(), "none") &&
-				std::strcmp(g_stamina_sound_editorID.c_str(), ""))
-			{
-				if (node)
-				{
-					if (!g_stamina_sound_editorID.empty() &&
-						std::strcmp(g_stamina_sound_editorID.c_str(), "none"))
-					{
-						if (auto sound_success =
-								helper::InitializeSound(g_stamina_sound, g_stamina_sound_editorID))
-						{
-							_DEBUGLOG("Playing sound '{}' : ", g_stamina_sound_editorID,
-								sound_success ? "success" : "failed");
-							helper::PlaySound(g_stamina_sound, 1.f,
-								pc->Get3D(g_vrik_disabled)->world.translate,
-								pc->Get3D(g_vrik_disabled));
-						}
-						else
-						{
-							SKSE::log::error("invalid editor ID : {}", g_stamina_sound_editorID);
-						}
-					}
-				}
-			}
-			// Visual Effect
-			if (g_stamina_visual_idx)
-			{
-				if (node)
-				{
-					if (auto artform = RE::TESForm::LookupByID(kvisuals[g_stamina_visual_idx - 1]);
-						artform && artform->GetFormType() == RE::FormType::ArtObject)
-					{
-						pc->ApplyArtObject(
-							artform->As<RE::BGSArtObject>(), 1, nullptr, false, false, node);
-						_DEBUGLOG("Applying art object with formid: {}",
-							kvisuals[g_stamina_visual_idx - 1]);
-					}
-				}
-			}
-		}
-		else { _DEBUGLOG("FX rate limit"); }
-	}
-
-	/* true: player has enough stamina */
-	bool TestStamina(float a_threshold)
-	{
-		if (a_threshold > 0.f)
-		{
-			float stam = 0;
-			if (a_threshold < 1.f)
-			{
-				// compare percentages
-				stam = helper::GetAVPercent(
-					RE::PlayerCharacter::GetSingleton(), RE::ActorValue::kStamina);
-			}
-			else
-			{
-				// compare flat values
-				stam = RE::PlayerCharacter::GetSingleton()->AsActorValueOwner()->GetActorValue(
-					RE::ActorValue::kStamina);
-			}
-			return stam > a_threshold;
-		}
-		return true;
-	}
-
-	void RegisterButtons(bool isLeft)
-	{
-		for (auto b : kCheckButtons)
-		{
-			vrinput::AddCallback(
-				OnButtonEvent, b, (vrinput::Hand)isLeft, vrinput::ActionType::kPress);
-		}
-	}
-
-	void UnregisterButtons(bool isLeft)
-	{
-		for (auto b : kCheckButtons)
-		{
-			vrinput::RemoveCallback(
-				OnButtonEvent, b, (vrinput::Hand)isLeft, vrinput::ActionType::kPress);
-		}
-	}
-
-	void RegisterVRInputCallback()
-	{
-		auto OVRHookManager = g_papyrusvr->GetOpenVRHook();
-		if (OVRHookManager && OVRHookManager->IsInitialized())
-		{
-			OVRHookManager = RequestOpenVRHookManagerObject();
-			if (OVRHookManager)
-			{
-				SKSE::log::info("Successfully requested OpenVRHookManagerAPI.");
-
-				vrinput::InitControllerHooks();
-
-				vrinput::g_leftcontroller =
-					OVRHookManager->GetVRSystem()->GetTrackedDeviceIndexForControllerRole(
-						vr::TrackedControllerRole_LeftHand);
-				vrinput::g_rightcontroller =
-					OVRHookManager->GetVRSystem()->GetTrackedDeviceIndexForControllerRole(
-						vr::TrackedControllerRole_RightHand);
-
-				vrinput::g_IVRSystem = OVRHookManager->GetVRSystem();
-
-				OVRHookManager->RegisterControllerStateCB(vrinput::ControllerInputCallback);
-				OVRHookManager->RegisterGetPosesCB(vrinput::ControllerPoseCallback);
-			}
-		}
-		else { SKSE::log::trace("Failed to initialize OVRHookManager"); }
-	}
-
-	bool ReadConfig(const char* a_ini_path)
-	{
-		using namespace std::filesystem;
-		static std::filesystem::file_time_type last_read = {};
-
-		auto config_path = helper::GetGamePath() / a_ini_path;
-
-		UnregisterButtons(g_left_hand_mode);
-
-		if (auto setting = RE::GetINISetting("bLeftHandedMode:VRInput"))
-		{
-			g_left_hand_mode = setting->GetBool();
-		}
-
-		if (auto setting = RE::GetINISetting("fArrowDistanceToNock:VRWand"))
-		{
-			g_overlap_radius = setting->GetFloat();
-		}
-
-		SKSE::log::info(
-			"bLeftHandedMode: {}\n fArrowDistanceToNock: {}", g_left_hand_mode, g_overlap_radius);
-		g_overlap_radius *= g_overlap_radius;
-
-		RegisterButtons(g_left_hand_mode);
-
-		try
-		{
-			auto last_write = last_write_time(config_path);
-
-			if (last_write > last_read)
-			{
-				std::ifstream config(config_path);
-				if (config.is_open())
-				{
-					g_enable_nocking = helper::ReadIntFromIni(config, "iEnableAutonocking");
-					g_firebutton = (vr::EVRButtonId)helper::ReadIntFromIni(config, "FireButtonID");
-					g_debug_print = helper::ReadIntFromIni(config, "Debug");
-					g_grace_period_ms = helper::ReadIntFromIni(config, "iGracePeriod");
-					g_stamina_threshold = helper::ReadFloatFromIni(config, "fStaminaThreshold");
-					if (g_stamina_threshold > 0.f)
-					{
-						g_stamina_autorecover =
-							helper::ReadIntFromIni(config, "iAutonockAfterBlocking");
-						g_stamina_haptic_strength =
-							helper::ReadFloatFromIni(config, "fHapticStrength");
-						g_stamina_visual_idx = helper::ReadIntFromIni(config, "iVisualEffect");
-						if (g_stamina_visual_idx < 0 || g_stamina_visual_idx > 2)
-						{
-							SKSE::log::trace("Invalid visual index, disabling");
-							g_stamina_visual_idx = 0;
-						}
-						g_stamina_sound_editorID =
-							helper::ReadStringFromIni(config, "sBlockedSound");
-					}
-					config.close();
-					last_read = last_write_time(config_path);
-					return true;
-				}
-				else
-				{
-					SKSE::log::error("error opening ini");
-					last_read = file_time_type{};
-				}
-			}
-			else { _DEBUGLOG("ini not read (no changes)"); }
-		} catch (const filesystem_error&)
-		{
-			SKSE::log::error("ini not found, using defaults");
-			last_read = file_time_type{};
-		}
-		return false;
-	}
-
-}
+#include "main_plugin.h"
+
+#include "spsc_ring.h"
+
+#include <chrono>
+
+namespace arrownock
+{
+	constexpr std::array kCheckButtons{ vr::k_EButton_SteamVR_Trigger, vr::k_EButton_A,
+		vr::k_EButton_Knuckles_B, vr::k_EButton_SteamVR_Touchpad, vr::k_EButton_Grip };
+
+	PapyrusVRAPI* g_papyrusvr;
+
+	// settings, written on the game and config watcher threads, read everywhere
+	EpochPtr<Settings>  g_settings;
+	helper::FileWatcher g_config_watcher;
+
+	// buttons the callbacks are registered for, only touched under the settings writer lock
+	bool            g_bound_left_hand_mode = false;
+	vr::EVRButtonId g_bound_firebutton = vr::k_EButton_Max;
+
+	RE::BSSoundHandle g_stamina_sound;
+
+	// state, pose thread only: Dispatch only runs there
+	ArrowState      g_state = ArrowState::kIdle;
+	RE::NiQuaternion g_unbent_bow_rotation;
+	vr::EVRButtonId g_arrow_held_button = vr::EVRButtonId::k_EButton_Max;
+
+	// written by the transition actions, pose thread only
+	struct ArrowContext
+	{
+		std::chrono::steady_clock::time_point last_arrow_hold;
+		bool                                  fake_button_down = false;
+		int                                   frame_count = 0;
+		bool                                  stamina_blocked = false;
+		// the current attempt was started by prediction and the hand has not reached the bow yet
+		bool                                  predicted_only = false;
+		std::chrono::steady_clock::time_point attempt_start;
+	};
+	ArrowContext g_context;
+
+	// inputs observed on other threads, dispatched at the start of the next OnUpdate so the state
+	// machine never runs on two threads at once
+	struct ArrowButtonEvent
+	{
+		vr::EVRButtonId                       button = vr::k_EButton_Max;
+		bool                                  down = false;
+		std::chrono::steady_clock::time_point time;
+	};
+	struct GameInput
+	{
+		ArrowInput      input = ArrowInput::kCount;
+		vr::EVRButtonId button = vr::k_EButton_Max;
+	};
+	SpscRing<ArrowButtonEvent, 64> g_button_events;  // from the input thread
+	// from the game thread, and from script threads that equip the player, so pushes are locked
+	SpscRing<GameInput, 16> g_game_inputs;
+	std::mutex              g_game_inputs_lock;
+
+	// nock attempts started on a predicted overlap that never actually happened
+	uint32_t g_false_predictions = 0;
+
+	// time from overlap to the detected nock, recorded on the pose thread
+	struct NockStats
+	{
+		std::atomic<uint32_t> attempts = 0;
+		std::atomic<uint32_t> abandoned = 0;    // hand left the bow before a nock was detected
+		std::atomic<uint32_t> false_nocks = 0;  // detected while the game was not drawing the bow
+		profiler::Histogram   frames;
+		profiler::Histogram   latency;  // ns
+	};
+	NockStats g_nock_stats;
+
+	// the arrow hand point and the arrow snap point in the frame of their controllers, so overlap
+	// can be computed from the raw poses. Pose thread only
+	struct PoseCalibration
+	{
+		RE::NiPoint3                          arrow_offset;
+		RE::NiPoint3                          bow_offset;
+		float                                 room_scale = 1.f;
+		bool                                  left_hand_mode = false;
+		bool                                  valid = false;
+		std::chrono::steady_clock::time_point time;
+	};
+	PoseCalibration g_pose_calibration;
+
+	constexpr auto  kRecalibrateInterval = std::chrono::seconds(1);
+	constexpr float kStillSpeed = 0.05f;  // m/s
+
+	// resources
+	// authored as one keyframe per frame at 90 Hz
+	const haptics::Pattern khaptic_pattern({ 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875,
+											   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3875,
+											   3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3750,
+											   3625, 3500, 3250, 2875, 2375, 2000, 1625, 1250, 1000,
+											   750, 625, 375, 375, 250, 125, 125 },
+		90.f);
+
+	inline void StateTransition(ArrowState a_next_state)
+	{
+		if (a_next_state != g_state)
+		{
+			_DEBUGTRACE(kStateChange, (int)g_state, (int)a_next_state);
+			g_state = a_next_state;
+		}
+	}
+
+	void Dispatch(ArrowInput a_input, vr::EVRButtonId a_button, const Settings& a_settings,
+		std::chrono::steady_clock::time_point a_time)
+	{
+		// nothing happens while turned off, so no action can run without its state change
+		if (!a_settings.ini.enable_nocking && a_input != ArrowInput::kReset) { return; }
+
+		auto [next, actions] = NextTransition(g_state, a_input);
+
+		if (actions & ArrowAction::kCaptureArrow)
+		{
+			// get the bow angle when no arrow is nocked
+			if (!GetBowHandRotation(&g_unbent_bow_rotation, a_settings)) { return; }
+			_DEBUGTRACE(kUnbentRotation, g_unbent_bow_rotation.w, g_unbent_bow_rotation.x,
+				g_unbent_bow_rotation.y, g_unbent_bow_rotation.z);
+			g_arrow_held_button = a_button;
+		}
+		if (actions & ArrowAction::kRecordRelease) { g_context.last_arrow_hold = a_time; }
+		if (actions & ArrowAction::kForgetButton) { g_arrow_held_button = vr::k_EButton_Max; }
+		if (actions & ArrowAction::kClearFake) { vrinput::ClearAllFake(); }
+		if (actions & ArrowAction::kStaminaFX) { PlayStaminaInhibitorFX(a_settings); }
+		if (actions & ArrowAction::kBlockStamina) { g_context.stamina_blocked = true; }
+		if (actions & ArrowAction::kUnblockStamina) { g_context.stamina_blocked = false; }
+		if (actions & ArrowAction::kCountFrame) { g_context.frame_count++; }
+		if (actions & ArrowAction::kStartAttempt)
+		{
+			g_context.fake_button_down = true;
+			g_context.frame_count = 0;
+			g_context.attempt_start = a_time;
+			TryNockArrow(true, a_settings);
+		}
+		if (actions & ArrowAction::kToggleAttempt)
+		{
+			g_context.fake_button_down ^= 1;
+			TryNockArrow(g_context.fake_button_down, a_settings);
+		}
+
+		StateTransition(next);
+	}
+
+	void QueueGameInput(ArrowInput a_input, vr::EVRButtonId a_button)
+	{
+		std::scoped_lock lock(g_game_inputs_lock);
+		if (!g_game_inputs.Push({ a_input, a_button }))
+		{
+			SKSE::log::warn("arrow input queue full, dropped input {}", (int)a_input);
+		}
+	}
+
+	/* The arrow button event of the input thread as the state machine sees it */
+	void DispatchArrowButton(const ArrowButtonEvent& a_event, const Settings& a_settings)
+	{
+		if (a_event.button != g_arrow_held_button) { return; }
+
+		_DEBUGTRACE(kArrowButton, a_event.button, a_event.down);
+
+		if (!a_event.down)
+		{
+			Dispatch(ArrowInput::kButtonUp, a_event.button, a_settings, a_event.time);
+		}
+		else if (g_state == ArrowState::kIdle)
+		{
+			// Check if we're still in the grace period
+			auto ms_since_release = std::chrono::duration_cast<std::chrono::milliseconds>(
+				a_event.time - g_context.last_arrow_hold)
+				.count();
+
+			if (ms_since_release < a_settings.ini.grace_period_ms)
+			{
+				_DEBUGTRACE(kArrowHoldResumed, ms_since_release);
+				Dispatch(ArrowInput::kButtonDownInGrace, a_event.button, a_settings, a_event.time);
+			}
+			else
+			{
+				// too late, stop listening to this button
+				Dispatch(ArrowInput::kButtonDownLate, a_event.button, a_settings, a_event.time);
+			}
+		}
+	}
+
+	void DispatchQueued(const Settings& a_settings)
+	{
+		// equips first, a button released right after equipping applies to the new arrow
+		GameInput input;
+		while (g_game_inputs.Pop(input)) { Dispatch(input.input, input.button, a_settings); }
+
+		ArrowButtonEvent button;
+		while (g_button_events.Pop(button)) { DispatchArrowButton(button, a_settings); }
+	}
+
+	void Init()
+	{
+		g_settings.Update([](Settings& a_settings) {
+			a_settings.vrik_disabled = GetModuleHandleA("vrik") == NULL;
+		});
+		SKSE::log::info("VRIK {} found", GetSettings()->vrik_disabled ? "not" : "DLL");
+
+		ReadConfig(g_ini_path);
+		g_config_watcher.Start(helper::GetGamePath() / g_ini_path, OnConfigFileChanged);
+
+		auto equip_sink = EventSink<RE::TESEquipEvent>::GetSingleton();
+		equip_sink->AddCallback(OnEquipped, IsPlayerArrowEquip);
+		RE::ScriptEventSourceHolder::GetSingleton()->AddEventSink(equip_sink);
+
+		auto load_sink = EventSink<RE::TESObjectLoadedEvent>::GetSingleton();
+		load_sink->AddCallback(OnPlayerLoaded, IsPlayerLoad);
+		RE::ScriptEventSourceHolder::GetSingleton()->AddEventSink(load_sink);
+
+		auto menu_sink = EventSink<RE::MenuOpenCloseEvent>::GetSingleton();
+		menu_sink->AddCallback(OnMenuOpenClose);
+		RE::UI::GetSingleton()->AddEventSink(menu_sink);
+
+		menuchecker::begin();
+		tracelog::Start();
+		RegisterVRInputCallback();
+	}
+
+	void OnGameLoad()
+	{
+		_DEBUGLOG("Load Game: reset state");
+		nodecache::Invalidate();
+		_DEBUGLOG("equip events delivered: {} filtered: {}",
+			EventSink<RE::TESEquipEvent>::GetSingleton()->Delivered(),
+			EventSink<RE::TESEquipEvent>::GetSingleton()->Filtered());
+		LogNockStats(*GetSettings());
+		QueueGameInput(ArrowInput::kReset, vr::k_EButton_Max);
+	}
+
+	void OnMenuOpenClose(RE::MenuOpenCloseEvent const* evn)
+	{
+		if (evn->opening) return;
+
+		// the game's handedness and nock distance can be changed from the settings menu
+		auto menu = menuchecker::getMenuID(evn->menuName);
+		if (menu == menuchecker::kJournalMenu) { ReadGameSettings(); }
+		// race change rebuilds the player's 3D
+		else if (menu == menuchecker::kRaceSexMenu) { nodecache::Invalidate(); }
+	}
+
+	bool IsPlayerLoad(const RE::TESObjectLoadedEvent* event)
+	{
+		return event && event->loaded &&
+			event->formID == RE::PlayerCharacter::GetSingleton()->GetFormID();
+	}
+
+	void OnPlayerLoaded(const RE::TESObjectLoadedEvent* event) { nodecache::Invalidate(); }
+
+	bool IsPlayerArrowEquip(const RE::TESEquipEvent* event)
+	{
+		if (!event || !event->actor || event->actor.get() != RE::PlayerCharacter::GetSingleton())
+		{
+			return false;
+		}
+
+		// is object an arrow, only looked up for the player's equips
+		auto form = RE::TESForm::LookupByID(event->baseObject);
+		return form && form->IsAmmo() && !form->As<RE::TESAmmo>()->IsBolt();
+	}
+
+	void OnEquipped(const RE::TESEquipEvent* event)
+	{
+		if (menuchecker::isGameStopped()) { return; }
+
+		EpochPtr<Settings>::Guard guard(g_settings);
+		auto                      settings = GetSettings();
+
+		if (!event->equipped)
+		{  // arrow was unequipped, go to idle state
+			QueueGameInput(ArrowInput::kUnequip, vr::k_EButton_Max);
+			return;
+		}
+
+		// does player have bow equipped
+		auto weap =
+			RE::PlayerCharacter::GetSingleton()->GetEquippedObject(!settings->left_hand_mode);
+		if (!weap || !weap->IsWeapon() || !weap->As<RE::TESObjectWEAP>()->IsBow()) { return; }
+
+		// Only one button is chosen, ordered by increasing likelihood of accidental button press
+		for (auto b : kCheckButtons)
+		{
+			if (vrinput::GetButtonState(b, (vrinput::Hand)settings->left_hand_mode,
+					vrinput::ActionType::kPress) == vrinput::ButtonState::kButtonDown)
+			{
+				_DEBUGLOG("arrow equipped with button press: {}", b);
+				QueueGameInput(ArrowInput::kEquipWithButton, b);
+				return;
+			}
+		}
+		QueueGameInput(ArrowInput::kEquipNoButton, vr::k_EButton_Max);
+	}
+
+	bool OnButtonEvent(const vrinput::ModInputEvent& e)
+	{
+		PROFILE_SCOPE(kOnButtonEvent);
+
+		EpochPtr<Settings>::Guard guard(g_settings);
+		auto                      settings = GetSettings();
+
+		// whether this is the arrow button is up to the pose thread, which owns the state
+		bool down = e.button_state == vrinput::ButtonState::kButtonDown;
+		if (!g_button_events.Push({ e.button_ID, down, std::chrono::steady_clock::now() }))
+		{
+			SKSE::log::warn("arrow button queue full, dropped event");
+		}
+
+		// Stamina Inhibitor Feature - manual nocking
+		if (e.button_ID == settings->ini.firebutton && down &&
+			settings->ini.stamina_threshold > 0.f)
+		{
+			if (!TestStamina(settings->ini.stamina_threshold))
+			{
+				if (auto weap = RE::PlayerCharacter::GetSingleton()->GetEquippedObject(
+						!settings->left_hand_mode);
+					weap && weap->IsWeapon() && weap->As<RE::TESObjectWEAP>()->IsBow())
+				{
+					if (auto ammo = RE::PlayerCharacter::GetSingleton()->GetCurrentAmmo();
+						ammo && !ammo->IsBolt())
+					{
+						if (IsOverlapping(settings->overlap_radius * 1.05, *settings))
+						{
+							// Player is attemping to fire a bow with not enough stamina, block the trigger press
+							PlayStaminaInhibitorFX(*settings);
+							return true;
+						}
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+
+	void OnUpdate()
+	{
+		EpochPtr<Settings>::Guard guard(g_settings);
+		auto                      settings = GetSettings();
+		float                     horizon = settings->ini.prediction_horizon_ms / 1000.f;
+
+		PROFILE_SCOPE(kOnUpdate);
+		PROFILE_DUMP_EVERY(std::chrono::seconds(settings->ini.profiler_interval_s));
+
+		DispatchQueued(*settings);
+
+		// the scene graph is a frame behind the poses, which only doesn't matter while the hands
+		// are still, so that is when the raw pose offsets are (re)calibrated
+		if (settings->ini.raw_pose_overlap && g_state != ArrowState::kTryToNock &&
+			std::chrono::steady_clock::now() - g_pose_calibration.time > kRecalibrateInterval &&
+			IsControllerStill(vrinput::Hand::kLeft) && IsControllerStill(vrinput::Hand::kRight))
+		{
+			CalibratePoseOffsets(*settings);
+		}
+
+		float radius = settings->overlap_radius * 0.95f;
+		auto& ctx = g_context;
+
+		switch (g_state)
+		{
+		case ArrowState::kArrowHeld:
+			if (!IsOverlappingFromPoses(radius, horizon, *settings))
+			{
+				// stamina inhibitor: unblock autonocking when player moves out of overlap zone,
+				// even if stamina has not recovered we'll check it again and repeat the FX next
+				// time they try
+				Dispatch(ArrowInput::kNoOverlap, g_arrow_held_button, *settings);
+			}
+			else if (ctx.stamina_blocked)
+			{
+				// player must move out of overlap zone to reset the stamina block
+				Dispatch(ArrowInput::kOverlapBlocked, g_arrow_held_button, *settings);
+			}
+			else if (settings->ini.stamina_threshold > 0.f &&
+					 !TestStamina(settings->ini.stamina_threshold))
+			{
+				// Stamina Inhibitor Feature: block auto nocking
+				Dispatch(settings->ini.stamina_autorecover ? ArrowInput::kOverlapLowStamina :
+															 ArrowInput::kOverlapLowStaminaLatch,
+					g_arrow_held_button, *settings);
+			}
+			else
+			{
+				ctx.predicted_only =
+					horizon > 0.f && !IsOverlappingFromPoses(radius, 0.f, *settings);
+				g_nock_stats.attempts.fetch_add(1, std::memory_order_relaxed);
+				Dispatch(ArrowInput::kOverlap, g_arrow_held_button, *settings);
+			}
+			break;
+		case ArrowState::kTryToNock:
+			if (ctx.predicted_only && IsOverlappingFromPoses(radius, 0.f, *settings))
+			{
+				ctx.predicted_only = false;
+			}
+
+			if (IsArrowNocked(*settings))
+			{
+				ctx.predicted_only = false;
+				auto latency = std::chrono::steady_clock::now() - ctx.attempt_start;
+				g_nock_stats.frames.Record(ctx.frame_count + 1);
+				g_nock_stats.latency.Record(
+					std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+				if (!IsDrawingBow())
+				{
+					g_nock_stats.false_nocks.fetch_add(1, std::memory_order_relaxed);
+				}
+				Dispatch(ArrowInput::kNocked, g_arrow_held_button, *settings);
+			}
+			else if (!IsOverlappingFromPoses(radius, horizon, *settings))
+			{
+				if (ctx.predicted_only)
+				{
+					ctx.predicted_only = false;
+					g_false_predictions++;
+					_DEBUGTRACE(kPredictionMissed, g_false_predictions);
+				}
+				g_nock_stats.abandoned.fetch_add(1, std::memory_order_relaxed);
+				Dispatch(ArrowInput::kNoOverlap, g_arrow_held_button, *settings);
+			}
+			else
+			{
+				bool tick = (ctx.frame_count + 1) % settings->ini.frames_between_attempts == 0;
+				Dispatch(tick ? ArrowInput::kAttemptTick : ArrowInput::kOverlap,
+					g_arrow_held_button, *settings);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	bool IsOverlapping(float a_radius_squared, const Settings& a_settings)
+	{
+		if (auto pcvr = RE::PlayerCharacter::GetSingleton()->GetVRNodeData())
+		{
+			// compute overlap
+			auto bow_node = pcvr->ArrowSnapNode;
+			auto arrow_node = a_settings.left_hand_mode ? pcvr->LeftWandNode : pcvr->RightWandNode;
+
+			return (arrow_node->world.translate - bow_node->world.translate).SqrLength() <
+				a_radius_squared;
+		}
+		return false;
+	}
+
+	/* true if a_offset, moving along a_velocity for up to a_horizon seconds, gets within the radius
+	*/
+	inline bool WithinRadius(RE::NiPoint3 a_offset, const RE::NiPoint3& a_velocity, float a_horizon,
+		float a_radius_squared)
+	{
+		// closest approach along the path the hand will travel within the horizon
+		if (float speed_squared = a_velocity.SqrLength(); a_horizon > 0.f && speed_squared > 0.f)
+		{
+			float t = std::clamp(-a_offset.Dot(a_velocity) / speed_squared, 0.f, a_horizon);
+			a_offset += a_velocity * t;
+		}
+		return a_offset.SqrLength() < a_radius_squared;
+	}
+
+	bool IsControllerStill(vrinput::Hand a_hand)
+	{
+		auto& pose = vrinput::GetGamePose(a_hand);
+		auto& v = pose.vVelocity.v;
+		return pose.bPoseIsValid &&
+			v[0] * v[0] + v[1] * v[1] + v[2] * v[2] < kStillSpeed * kStillSpeed;
+	}
+
+	void CalibratePoseOffsets(const Settings& a_settings)
+	{
+		auto pcvr = RE::PlayerCharacter::GetSingleton()->GetVRNodeData();
+		if (!pcvr || !pcvr->RoomNode) return;
+
+		auto  arrow_hand = (vrinput::Hand)a_settings.left_hand_mode;
+		auto& arrow_pose = vrinput::GetGamePose(arrow_hand);
+		auto& bow_pose = vrinput::GetGamePose(vrinput::GetOtherHand(arrow_hand));
+		if (!arrow_pose.bPoseIsValid || !bow_pose.bPoseIsValid) return;
+
+		auto& room = pcvr->RoomNode->world;
+		auto  to_room = [&](const RE::NiPoint3& a_world) {
+			return room.rotate.Transpose() * (a_world - room.translate) / room.scale;
+		};
+		auto to_local = [&](const vr::TrackedDevicePose_t& a_pose, const RE::NiPoint3& a_world) {
+			auto controller = vrinput::GamePoseToRoomTransform(a_pose, a_settings.units_per_meter);
+			return controller.rotate.Transpose() * (to_room(a_world) - controller.translate);
+		};
+
+		auto arrow_node = a_settings.left_hand_mode ? pcvr->LeftWandNode : pcvr->RightWandNode;
+
+		g_pose_calibration.arrow_offset = to_local(arrow_pose, arrow_node->world.translate);
+		g_pose_calibration.bow_offset = to_local(bow_pose, pcvr->ArrowSnapNode->world.translate);
+		g_pose_calibration.room_scale = room.scale;
+		g_pose_calibration.left_hand_mode = a_settings.left_hand_mode;
+		g_pose_calibration.time = std::chrono::steady_clock::now();
+		g_pose_calibration.valid = true;
+	}
+
+	bool IsOverlappingFromPoses(
+		float a_radius_squared, float a_horizon, const Settings& a_settings)
+	{
+		auto  arrow_hand = (vrinput::Hand)a_settings.left_hand_mode;
+		auto& arrow_pose = vrinput::GetGamePose(arrow_hand);
+		auto& bow_pose = vrinput::GetGamePose(vrinput::GetOtherHand(arrow_hand));
+
+		if (!arrow_pose.bPoseIsValid || !bow_pose.bPoseIsValid)
+		{
+			return IsOverlapping(a_radius_squared, a_settings);
+		}
+
+		vr::HmdVector3_t relative;
+		for (int i = 0; i < 3; i++)
+		{
+			relative.v[i] = arrow_pose.vVelocity.v[i] - bow_pose.vVelocity.v[i];
+		}
+
+		auto& cal = g_pose_calibration;
+		if (a_settings.ini.raw_pose_overlap && cal.valid &&
+			cal.left_hand_mode == a_settings.left_hand_mode)
+		{
+			// everything in room space, distances do not depend on the room's orientation
+			auto arrow = vrinput::GamePoseToRoomTransform(arrow_pose, a_settings.units_per_meter);
+			auto bow = vrinput::GamePoseToRoomTransform(bow_pose, a_settings.units_per_meter);
+
+			auto offset = ((arrow.rotate * cal.arrow_offset + arrow.translate) -
+							  (bow.rotate * cal.bow_offset + bow.translate)) *
+				cal.room_scale;
+			auto velocity = vrinput::TrackingToRoomVector(relative, a_settings.units_per_meter) *
+				cal.room_scale;
+
+			return WithinRadius(offset, velocity, a_horizon, a_radius_squared);
+		}
+
+		if (auto pcvr = RE::PlayerCharacter::GetSingleton()->GetVRNodeData())
+		{
+			auto arrow_node = a_settings.left_hand_mode ? pcvr->LeftWandNode : pcvr->RightWandNode;
+			auto offset = arrow_node->world.translate - pcvr->ArrowSnapNode->world.translate;
+			auto velocity = vrinput::TrackingToWorldVector(relative, a_settings.units_per_meter);
+
+			return WithinRadius(offset, velocity, a_horizon, a_radius_squared);
+		}
+		return false;
+	}
+
+	/* Get the angle between the bow and the hand, normally fixed but any change indicates arrow is in place */
+	bool GetBowHandRotation(RE::NiQuaternion* out, const Settings& a_settings)
+	{
+		auto bow = nodecache::Get(nodecache::Node::kBow, a_settings.vrik_disabled);
+		auto hand = vrinput::GetHandNode(
+			(vrinput::Hand)!a_settings.left_hand_mode, a_settings.vrik_disabled);
+
+		if (bow && hand)
+		{
+			*out = helper::Mat2Quat(bow->world.rotate.Transpose() * hand->world.rotate);
+			return true;
+		}
+		return false;
+	}
+
+	/* Checks if the current hand-bow angle is different from the base */
+	bool IsArrowNocked(const Settings& a_settings)
+	{
+		if (RE::NiQuaternion rotation; GetBowHandRotation(&rotation, a_settings))
+		{
+			auto sin_sq = helper::QuatHalfAngleSinSq(g_unbent_bow_rotation, rotation);
+			_DEBUGTRACE(kIsArrowNocked, sin_sq);
+			return sin_sq > a_settings.nock_half_angle_sin_sq;
+		}
+		return false;
+	}
+
+	bool IsDrawingBow()
+	{
+		auto state = RE::PlayerCharacter::GetSingleton()->AsActorState()->GetAttackState();
+		return state >= RE::ATTACK_STATE_ENUM::kBowDraw &&
+			state <= RE::ATTACK_STATE_ENUM::kBowDrawn;
+	}
+
+	void LogNockStats(const Settings& a_settings)
+	{
+		auto attempts = g_nock_stats.attempts.exchange(0, std::memory_order_relaxed);
+		auto abandoned = g_nock_stats.abandoned.exchange(0, std::memory_order_relaxed);
+		auto false_nocks = g_nock_stats.false_nocks.exchange(0, std::memory_order_relaxed);
+		auto frames = g_nock_stats.frames.TakeSummary();
+		auto latency = g_nock_stats.latency.TakeSummary();
+		if (!attempts) { return; }
+
+		SKSE::log::info(
+			"nocking with radius {} angle {} attempt every {} frames: {} attempts, {} nocked, {} "
+			"abandoned, {} false nocks ({:.1f}%)",
+			std::sqrt(a_settings.overlap_radius), a_settings.ini.nock_angle_threshold,
+			a_settings.ini.frames_between_attempts, attempts, frames.count, abandoned, false_nocks,
+			frames.count ? 100.f * false_nocks / frames.count : 0.f);
+		if (frames.count)
+		{
+			SKSE::log::info("overlap to nock: p50 {} frames {:.1f}ms, p99 {} frames {:.1f}ms, "
+							"max {} frames {:.1f}ms",
+				frames.p50, latency.p50 / 1e6, frames.p99, latency.p99 / 1e6, frames.max,
+				latency.max / 1e6);
+		}
+	}
+
+	void TryNockArrow(bool a_start_spoof, const Settings& a_settings)
+	{
+		auto firebutton = (vr::EVRButtonId)a_settings.ini.firebutton;
+		auto hand = a_settings.left_hand_mode ? vrinput::Hand::kLeft : vrinput::Hand::kRight;
+
+		if (a_start_spoof)
+		{
+			if (g_arrow_held_button == firebutton)
+			{
+				auto isfiredown = vrinput::GetButtonState(
+					g_arrow_held_button, vrinput::Hand::kRight, vrinput::ActionType::kPress);
+				_DEBUGTRACE(kFakeFireRelease, (bool)isfiredown);
+				vrinput::SendFakeInputEvent(
+					{ .device = hand,
+						.touch_or_press = vrinput::ActionType::kPress,
+						.button_state = vrinput::ButtonState::kButtonUp,
+						.button_ID = firebutton });
+			}
+			else
+			{
+				_DEBUGTRACE(kFakeFireDown);
+				vrinput::SetFakeButtonState({
+					.device = hand,
+					.touch_or_press = vrinput::ActionType::kPress,
+					.button_state = vrinput::ButtonState::kButtonDown,
+					.button_ID = firebutton,
+				});
+				vrinput::SetFakeButtonState({
+					.device = hand,
+					.touch_or_press = vrinput::ActionType::kTouch,
+					.button_state = vrinput::ButtonState::kButtonDown,
+					.button_ID = firebutton,
+				});
+			}
+		}
+		else
+		{  // reset button so we can try again in a few frames
+			if (g_arrow_held_button != firebutton)
+			{
+				_DEBUGTRACE(kClearFake);
+				vrinput::ClearAllFake();
+			}
+		}
+	}
+
+	void PlayStaminaInhibitorFX(const Settings& a_settings)
+	{
+		constexpr int kMinFXInterval = 1400;
+
+		static std::chrono::steady_clock::time_point last_played = {};
+
+		auto now = std::chrono::steady_clock::now();
+
+		if (std::chrono::duration_cast<std::chrono::milliseconds>(now - last_played).count() >
+			kMinFXInterval)
+		{
+			last_played = now;
+
+			_DEBUGLOG("Bow draw blocked, stamina: {} ({}%) ",
+				RE::PlayerCharacter::GetSingleton()->AsActorValueOwner()->GetActorValue(
+					RE::ActorValue::kStamina),
+				helper::GetAVPercent(
+					RE::PlayerCharacter::GetSingleton(), RE::ActorValue::kStamina));
+
+			auto& ini = a_settings.ini;
+			auto  pc = RE::PlayerCharacter::GetSingleton();
+			auto  node = nodecache::Get(nodecache::Node::kLeftFinger, a_settings.vrik_disabled);
+
+			// Controller vibration
+			if (ini.stamina_haptic_strength > 0.f)
+			{
+				_DEBUGLOG("Activating haptics");
+				vrinput::Vibrate(
+					!a_settings.left_hand_mode, khaptic_pattern, ini.stamina_haptic_strength);
+			}
+			// Sound Effect
+			if (!ini.stamina_sound_editorID.empty() &&
+				std::strcmp(ini.stamina_sound_editorID.c_str(), "none") &&
+				std::strcmp(ini.stamina_sound_editorID.c_str(), ""))
+			{
+				if (node)
+				{
+					if (!ini.stamina_sound_editorID.empty() &&
+						std::strcmp(ini.stamina_sound_editorID.c_str(), "none"))
+					{
+						if (auto sound_success = helper::InitializeSound(
+								g_stamina_sound, ini.stamina_sound_editorID))
+						{
+							_DEBUGLOG("Playing sound '{}' : ", ini.stamina_sound_editorID,
+								sound_success ? "success" : "failed");
+							helper::PlaySound(g_stamina_sound, 1.f,
+								pc->Get3D(a_settings.vrik_disabled)->world.translate,
+								pc->Get3D(a_settings.vrik_disabled));
+						}
+						else
+						{
+							SKSE::log::error("invalid editor ID : {}", ini.stamina_sound_editorID);
+						}
+					}
+				}
+			}
+			// Visual Effect
+			if (ini.stamina_visual_idx)
+			{
+				if (node)
+				{
+					if (auto artform =
+							RE::TESForm::LookupByID(kvisuals[ini.stamina_visual_idx - 1]);
+						artform && artform->GetFormType() == RE::FormType::ArtObject)
+					{
+						pc->ApplyArtObject(
+							artform->As<RE::BGSArtObject>(), 1, nullptr, false, false, node);
+						_DEBUGLOG("Applying art object with formid: {}",
+							kvisuals[ini.stamina_visual_idx - 1]);
+					}
+				}
+			}
+		}
+		else { _DEBUGTRACE(kFXRateLimit); }
+	}
+
+	/* true: player has enough stamina */
+	bool TestStamina(float a_threshold)
+	{
+		if (a_threshold > 0.f)
+		{
+			float stam = 0;
+			if (a_threshold < 1.f)
+			{
+				// compare percentages
+				stam = helper::GetAVPercent(
+					RE::PlayerCharacter::GetSingleton(), RE::ActorValue::kStamina);
+			}
+			else
+			{
+				// compare flat values
+				stam = RE::PlayerCharacter::GetSingleton()->AsActorValueOwner()->GetActorValue(
+					RE::ActorValue::kStamina);
+			}
+			return stam > a_threshold;
+		}
+		return true;
+	}
+
+	inline bool IsCheckButton(vr::EVRButtonId a_button)
+	{
+		return std::ranges::find(kCheckButtons, a_button) != kCheckButtons.end();
+	}
+
+	void RegisterButtons(bool isLeft, vr::EVRButtonId a_firebutton)
+	{
+		for (auto b : kCheckButtons)
+		{
+			vrinput::AddCallback(
+				OnButtonEvent, b, (vrinput::Hand)isLeft, vrinput::ActionType::kPress);
+		}
+		if (!IsCheckButton(a_firebutton))
+		{
+			vrinput::AddCallback(
+				OnButtonEvent, a_firebutton, (vrinput::Hand)isLeft, vrinput::ActionType::kPress);
+		}
+	}
+
+	void UnregisterButtons(bool isLeft, vr::EVRButtonId a_firebutton)
+	{
+		for (auto b : kCheckButtons)
+		{
+			vrinput::RemoveCallback(
+				OnButtonEvent, b, (vrinput::Hand)isLeft, vrinput::ActionType::kPress);
+		}
+		if (!IsCheckButton(a_firebutton))
+		{
+			vrinput::RemoveCallback(
+				OnButtonEvent, a_firebutton, (vrinput::Hand)isLeft, vrinput::ActionType::kPress);
+		}
+	}
+
+	void RebindButtons(bool a_left_hand_mode, vr::EVRButtonId a_firebutton)
+	{
+		UnregisterButtons(g_bound_left_hand_mode, g_bound_firebutton);
+		g_bound_left_hand_mode = a_left_hand_mode;
+		g_bound_firebutton = a_firebutton;
+		RegisterButtons(g_bound_left_hand_mode, g_bound_firebutton);
+	}
+
+	void RegisterVRInputCallback()
+	{
+		auto OVRHookManager = g_papyrusvr->GetOpenVRHook();
+		if (OVRHookManager && OVRHookManager->IsInitialized())
+		{
+			OVRHookManager = RequestOpenVRHookManagerObject();
+			if (OVRHookManager)
+			{
+				SKSE::log::info("Successfully requested OpenVRHookManagerAPI.");
+
+				vrinput::InitControllerHooks();
+
+				vrinput::g_leftcontroller =
+					OVRHookManager->GetVRSystem()->GetTrackedDeviceIndexForControllerRole(
+						vr::TrackedControllerRole_LeftHand);
+				vrinput::g_rightcontroller =
+					OVRHookManager->GetVRSystem()->GetTrackedDeviceIndexForControllerRole(
+						vr::TrackedControllerRole_RightHand);
+
+				vrinput::g_IVRSystem = OVRHookManager->GetVRSystem();
+				haptics::PulseDispatcher::GetSingleton()->Start(vrinput::g_IVRSystem);
+
+#ifdef ENABLE_PROFILER
+				vrinput::AddHoldCallback(OnProfilerChord, std::chrono::milliseconds(2000),
+					vr::k_EButton_Grip, vrinput::Hand::kRight, vrinput::ActionType::kPress);
+#endif
+
+				OVRHookManager->RegisterControllerStateCB(vrinput::ControllerInputCallback);
+				OVRHookManager->RegisterGetPosesCB(vrinput::ControllerPoseCallback);
+			}
+		}
+		else { SKSE::log::trace("Failed to initialize OVRHookManager"); }
+	}
+
+	bool OnProfilerChord(const vrinput::ModInputEvent& e)
+	{
+		if (vrinput::GetButtonState(vr::k_EButton_Grip, vrinput::Hand::kLeft,
+				vrinput::ActionType::kPress) == vrinput::ButtonState::kButtonDown)
+		{
+			SKSE::GetTaskInterface()->AddTask([]() { profiler::Dump(); });
+		}
+		return false;
+	}
+
+	void ReadGameSettings()
+	{
+		g_settings.Update([](Settings& a_settings) {
+			LogNockStats(a_settings);
+
+			if (auto setting = RE::GetINISetting("fArrowDistanceToNock:VRWand"))
+			{
+				a_settings.overlap_radius = setting->GetFloat() * setting->GetFloat();
+			}
+
+			if (auto setting = RE::GetINISetting("fVrScale:VR"))
+			{
+				a_settings.units_per_meter = setting->GetFloat();
+			}
+
+			if (auto setting = RE::GetINISetting("bLeftHandedMode:VRInput");
+				setting && setting->GetBool() != a_settings.left_hand_mode)
+			{
+				a_settings.left_hand_mode = setting->GetBool();
+				SKSE::log::info("bLeftHandedMode changed: {}", a_settings.left_hand_mode);
+				RebindButtons(
+					a_settings.left_hand_mode, (vr::EVRButtonId)a_settings.ini.firebutton);
+			}
+		});
+	}
+
+	template <typename T>
+	inline void LogIfChanged(const char* a_key, const T& a_old, const T& a_new)
+	{
+		if (a_old != a_new) { SKSE::log::info("{} changed: {} -> {}", a_key, a_old, a_new); }
+	}
+
+	void ApplyIniSettings(const IniSettings& a_ini)
+	{
+		bool disabled = false;
+
+		g_settings.Update([&](Settings& a_settings) {
+			auto& old = a_settings.ini;
+			LogNockStats(a_settings);
+			disabled = old.enable_nocking && !a_ini.enable_nocking;
+
+			// fire button is the only ini setting that needs the button callbacks redone
+			if (a_ini.firebutton != old.firebutton)
+			{
+				RebindButtons(a_settings.left_hand_mode, (vr::EVRButtonId)a_ini.firebutton);
+			}
+
+			LogIfChanged("iEnableAutonocking", old.enable_nocking, a_ini.enable_nocking);
+			LogIfChanged("FireButtonID", old.firebutton, a_ini.firebutton);
+			LogIfChanged("Debug", old.debug_level, a_ini.debug_level);
+			LogIfChanged("iGracePeriod", old.grace_period_ms, a_ini.grace_period_ms);
+			LogIfChanged("fStaminaThreshold", old.stamina_threshold, a_ini.stamina_threshold);
+			LogIfChanged(
+				"iAutonockAfterBlocking", old.stamina_autorecover, a_ini.stamina_autorecover);
+			LogIfChanged(
+				"fHapticStrength", old.stamina_haptic_strength, a_ini.stamina_haptic_strength);
+			LogIfChanged("iVisualEffect", old.stamina_visual_idx, a_ini.stamina_visual_idx);
+			LogIfChanged(
+				"sBlockedSound", old.stamina_sound_editorID, a_ini.stamina_sound_editorID);
+			LogIfChanged(
+				"fPredictionHorizonMs", old.prediction_horizon_ms, a_ini.prediction_horizon_ms);
+			LogIfChanged("iRawPoseOverlap", old.raw_pose_overlap, a_ini.raw_pose_overlap);
+			LogIfChanged("iProfilerInterval", old.profiler_interval_s, a_ini.profiler_interval_s);
+			LogIfChanged(
+				"fNockAngleThreshold", old.nock_angle_threshold, a_ini.nock_angle_threshold);
+			LogIfChanged("iFramesBetweenAttempts", old.frames_between_attempts,
+				a_ini.frames_between_attempts);
+
+			a_settings.ini = a_ini;
+			a_settings.nock_half_angle_sin_sq = helper::HalfAngleSinSq(a_ini.nock_angle_threshold);
+		});
+
+		// inputs are ignored once disabled, so drop an attempt in progress and its fake button
+		if (disabled) { QueueGameInput(ArrowInput::kReset, vr::k_EButton_Max); }
+	}
+
+	void OnConfigFileChanged(const std::filesystem::path& a_path)
+	{
+		// parse here on the watcher thread, only the apply step runs on the game thread
+		auto text = helper::ReadWholeFile(a_path);
+		if (!text)
+		{
+			SKSE::log::error("error opening ini");
+			return;
+		}
+
+		IniSettings ini;
+		helper::ApplyIni(*text, kIniIndex, ini);
+
+		SKSE::log::info("ini changed, reloading");
+		SKSE::GetTaskInterface()->AddTask([ini]() { ApplyIniSettings(ini); });
+	}
+
+	bool ReadConfig(const char* a_ini_path)
+	{
+		ReadGameSettings();
+		SKSE::log::info("bLeftHandedMode: {}\n fArrowDistanceToNock: {}",
+			GetSettings()->left_hand_mode, std::sqrt(GetSettings()->overlap_radius));
+
+		// nothing else publishes yet, the initial binding can be done outside of an update
+		RebindButtons(
+			GetSettings()->left_hand_mode, (vr::EVRButtonId)GetSettings()->ini.firebutton);
+
+		if (auto text = helper::ReadWholeFile(helper::GetGamePath() / a_ini_path))
+		{
+			IniSettings ini;
+			helper::ApplyIni(*text, kIniIndex, ini);
+			ApplyIniSettings(ini);
+			return true;
+		}
+
+		SKSE::log::error("ini not found, using defaults");
+		return false;
+	}
+
+}
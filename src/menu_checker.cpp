@@ -2,69 +2,80 @@
 
 #include "mod_event_sink.hpp"
 
+#include <bitset>
+
 namespace menuchecker
 {
-	bool isGameStoppedState = true;
+	static_assert(kTrackedMenus.size() <= 64, "open menus are tracked in a 64 bit set");
+
+	// BSFixedStrings are interned by the game, so equal names share one data pointer and a menu
+	// event can be matched by pointer alone. The table keeps the names alive so the pointers stay
+	// valid.
+	constexpr size_t kTableSize = 128;
+	static_assert(kTableSize >= kTrackedMenus.size() * 2, "keep the table at most half full");
+
+	struct InternedName
+	{
+		const char* key = nullptr;
+		int         id = kInvalidMenu;
+	};
+
+	std::array<RE::BSFixedString, kTrackedMenus.size()> internedNames;
+	std::array<InternedName, kTableSize>                 nameTable;
+
+	// game thread only
+	std::bitset<kTrackedMenus.size()> openMenus;
+	int                               openStoppingMenus = 0;
+
+	// read from the input thread on every poll
+	std::atomic<bool> isGameStoppedState = true;
+
+	bool isGameStopped() { return isGameStoppedState.load(std::memory_order_acquire); }
 
-	bool isGameStopped() { return isGameStoppedState; }
+	inline size_t hashName(const char* a_key)
+	{
+		// Fibonacci hashing, the low bits of a pointer carry no information
+		return (size_t)(((uintptr_t)a_key >> 4) * 0x9E3779B97F4A7C15ull >> 57) & (kTableSize - 1);
+	}
 
-	bool updateGameStopped()
+	int getMenuID(const RE::BSFixedString& a_name)
 	{
-		for (auto menu : gameStoppingMenus)
+		auto key = a_name.data();
+		for (auto i = hashName(key);; i = (i + 1) & (kTableSize - 1))
 		{
-			if (menuTypes[menu] == true) { return true; }
+			if (nameTable[i].key == key) { return nameTable[i].id; }
+			if (!nameTable[i].key) { return kInvalidMenu; }
 		}
-		return false;
 	}
 
 	void onMenuOpenClose(RE::MenuOpenCloseEvent const* evn)
 	{
-		const char* menuName = evn->menuName.data();
-
-		if (evn->opening)
-		{  // Menu opened
-			if (menuTypes.find(menuName) != menuTypes.end()) { menuTypes[menuName] = true; }
-		} else
-		{  // Menu closed
-			if (menuTypes.find(menuName) != menuTypes.end()) { menuTypes[menuName] = false; }
-		}
+		auto id = getMenuID(evn->menuName);
+		if (id == kInvalidMenu || openMenus.test(id) == evn->opening) { return; }
+
+		openMenus.set(id, evn->opening);
+		if (kTrackedMenus[id].stops_game) { openStoppingMenus += evn->opening ? 1 : -1; }
 
-		isGameStoppedState = updateGameStopped();
+		isGameStoppedState.store(openStoppingMenus > 0, std::memory_order_release);
 	}
 
 	void begin()
 	{
-		std::once_flag once;
+		static std::once_flag once;
 		std::call_once(once, []() {
+			for (int id = 0; id < (int)kTrackedMenus.size(); id++)
+			{
+				internedNames[id] = kTrackedMenus[id].name;
+
+				auto key = internedNames[id].data();
+				auto i = hashName(key);
+				while (nameTable[i].key) { i = (i + 1) & (kTableSize - 1); }
+				nameTable[i] = { key, id };
+			}
+
 			auto menuSink = EventSink<RE::MenuOpenCloseEvent>::GetSingleton();
 			menuSink->AddCallback(onMenuOpenClose);
 			RE::UI::GetSingleton()->AddEventSink(menuSink);
 		});
 	}
-
-	std::vector<std::string> gameStoppingMenus{ "BarterMenu", "Book Menu", "Console",
-		"Native UI Menu", "ContainerMenu", "Dialogue Menu", "Crafting Menu", "Credits Menu",
-		"Cursor Menu", "Debug Text Menu", "FavoritesMenu", "GiftMenu", "InventoryMenu",
-		"Journal Menu", "Kinect Menu", "Loading Menu", "Lockpicking Menu", "MagicMenu", "Main Menu",
-		"MapMarkerText3D", "MapMenu", "MessageBoxMenu", "Mist Menu", "Quantity Menu",
-		"RaceSex Menu", "Sleep/Wait Menu", "StatsMenuSkillRing", "StatsMenuPerks", "Training Menu",
-		"Tutorial Menu", "TweenMenu" };
-
-	std::unordered_map<std::string, bool> menuTypes(
-		{ { "BarterMenu", false }, { "Book Menu", false }, { "Console", false },
-			{ "Native UI Menu", false }, { "ContainerMenu", false }, { "Dialogue Menu", false },
-			{ "Crafting Menu", false }, { "Credits Menu", false }, { "Cursor Menu", false },
-			{ "Debug Text Menu", false }, { "Fader Menu", false }, { "FavoritesMenu", false },
-			{ "GiftMenu", false }, { "HUD Menu", false }, { "InventoryMenu", false },
-			{ "Journal Menu", false }, { "Kinect Menu", false }, { "Loading Menu", false },
-			{ "Lockpicking Menu", false }, { "MagicMenu", false }, { "Main Menu", false },
-			{ "MapMarkerText3D", false }, { "MapMenu", false }, { "MessageBoxMenu", false },
-			{ "Mist Menu", false }, { "Overlay Interaction Menu", false },
-			{ "Overlay Menu", false }, { "Quantity Menu", false }, { "RaceSex Menu", false },
-			{ "Sleep/Wait Menu", false }, { "StatsMenu", false }, { "StatsMenuPerks", false },
-			{ "StatsMenuSkillRing", false }, { "TitleSequence Menu", false }, { "Top Menu", false },
-			{ "Training Menu", false }, { "Tutorial Menu", false }, { "TweenMenu", false },
-			{ "WSEnemyMeters", false }, { "WSDebugOverlay", false },
-			{ "WSActivateRollover", false }, { "LoadWaitSpinner", false } });
-
 }
@@ -0,0 +1,50 @@
+#include "node_cache.h"
+
+namespace nodecache
+{
+	// bumped by Invalidate whenever the player's 3D may have been rebuilt, which frees the old
+	// nodes. Each thread cache compares it to the one it was filled at
+	std::atomic<uint32_t> generation = 0;
+
+	struct RootCache
+	{
+		// not references, holding those from every thread would keep a replaced skeleton alive
+		RE::NiAVObject*                                   root = nullptr;
+		std::array<RE::NiAVObject*, (size_t)Node::kCount> nodes{};
+	};
+
+	struct ThreadCache
+	{
+		uint32_t  generation = 0;
+		RootCache roots[2];  // third person, first person
+	};
+
+	RE::NiAVObject* Get(Node a_node, bool a_first_person)
+	{
+		thread_local ThreadCache cache;
+
+		auto pc = RE::PlayerCharacter::GetSingleton();
+		auto root = pc ? pc->Get3D(a_first_person) : nullptr;
+		if (!root) { return nullptr; }
+
+		if (auto current = generation.load(std::memory_order_acquire); cache.generation != current)
+		{
+			cache = {};
+			cache.generation = current;
+		}
+
+		auto& entry = cache.roots[a_first_person];
+		if (entry.root != root)
+		{
+			entry = {};
+			entry.root = root;
+		}
+
+		// missing nodes are looked up again next time, some are only attached later
+		auto& node = entry.nodes[(size_t)a_node];
+		if (!node) { node = root->GetObjectByName(kNodeNames[(size_t)a_node]); }
+		return node;
+	}
+
+	void Invalidate() { generation.fetch_add(1, std::memory_order_release); }
+}
@@ -0,0 +1,78 @@
+#include "profiler.h"
+
+#include <bit>
+
+namespace profiler
+{
+	std::array<Histogram, (size_t)Stage::kCount> histograms;
+
+	Histogram& GetHistogram(Stage a_stage) { return histograms[(size_t)a_stage]; }
+
+	int Histogram::BucketOf(uint64_t a_ns)
+	{
+		if (a_ns < kSubBuckets) { return (int)a_ns; }
+
+		int exponent = std::min((int)std::bit_width(a_ns) - 1, kMaxExponent);
+		int sub = (int)(a_ns >> (exponent - kSubBits)) & (kSubBuckets - 1);
+		return (exponent - kSubBits + 1) * kSubBuckets + sub;
+	}
+
+	uint64_t Histogram::BucketFloor(int a_bucket)
+	{
+		if (a_bucket < kSubBuckets) { return a_bucket; }
+
+		int exponent = a_bucket / kSubBuckets + kSubBits - 1;
+		int sub = a_bucket % kSubBuckets;
+		return (uint64_t)(kSubBuckets + sub) << (exponent - kSubBits);
+	}
+
+	Histogram::Summary Histogram::TakeSummary()
+	{
+		std::array<uint32_t, kBuckets> counts;
+		Summary                        summary;
+
+		for (int i = 0; i < kBuckets; i++)
+		{
+			counts[i] = buckets[i].exchange(0, std::memory_order_relaxed);
+			summary.count += counts[i];
+		}
+		summary.max = max.exchange(0, std::memory_order_relaxed);
+		if (!summary.count) { return summary; }
+
+		uint64_t p50_rank = (summary.count + 1) / 2;
+		uint64_t p99_rank = std::max<uint64_t>(summary.count * 99 / 100, 1);
+		uint64_t seen = 0;
+		for (int i = 0; i < kBuckets && seen < p99_rank; i++)
+		{
+			if (!counts[i]) { continue; }
+			if (seen < p50_rank && seen + counts[i] >= p50_rank) { summary.p50 = BucketFloor(i); }
+			seen += counts[i];
+			if (seen >= p99_rank) { summary.p99 = BucketFloor(i); }
+		}
+		return summary;
+	}
+
+	void Dump()
+	{
+		for (size_t i = 0; i < histograms.size(); i++)
+		{
+			auto s = histograms[i].TakeSummary();
+			if (!s.count) { continue; }
+			SKSE::log::info("{:<24} n={:<8} p50={:>8}ns p99={:>8}ns max={:>8}ns", kStageNames[i],
+				s.count, s.p50, s.p99, s.max);
+		}
+	}
+
+	void DumpEvery(std::chrono::seconds a_interval)
+	{
+		static Clock::time_point last_dump = Clock::now();
+
+		if (a_interval.count() <= 0) return;
+
+		if (auto now = Clock::now(); now - last_dump >= a_interval)
+		{
+			last_dump = now;
+			SKSE::GetTaskInterface()->AddTask([]() { Dump(); });
+		}
+	}
+}
@@ -0,0 +1,362 @@
+#include "rotation_batch.h"
+#include "helper_math.h"
+
+#include <immintrin.h>
+
+namespace helper
+{
+	using RE::NiMatrix3;
+	using RE::NiQuaternion;
+
+	namespace
+	{
+		/* One float per lane. Comparisons return a lane mask of all ones or all zeros. The 8 wide
+		* form only uses AVX, but without AVX2 GCC turns its blends into scalar code
+		*/
+#ifdef __AVX2__
+		struct Floats
+		{
+			static constexpr size_t kWidth = 8;
+
+			__m256 v;
+
+			static Floats Set(float a) { return { _mm256_set1_ps(a) }; }
+
+			// a[0], a[a_stride] ... one float per lane
+			static Floats Gather(const float* a, size_t s)
+			{
+				return { _mm256_set_ps(
+					a[7 * s], a[6 * s], a[5 * s], a[4 * s], a[3 * s], a[2 * s], a[s], a[0]) };
+			}
+			void Scatter(float* a, size_t s) const
+			{
+				alignas(32) float lanes[kWidth];
+				_mm256_store_ps(lanes, v);
+				for (size_t i = 0; i < kWidth; i++) { a[i * s] = lanes[i]; }
+			}
+
+			// 4 floats at a to the low half, 4 at a + a_stride to the high half
+			static Floats LoadHalves(const float* a, size_t a_stride)
+			{
+				return { _mm256_insertf128_ps(
+					_mm256_castps128_ps256(_mm_loadu_ps(a)), _mm_loadu_ps(a + a_stride), 1) };
+			}
+			void StoreHalves(float* a, size_t a_stride) const
+			{
+				_mm_storeu_ps(a, _mm256_castps256_ps128(v));
+				_mm_storeu_ps(a + a_stride, _mm256_extractf128_ps(v, 1));
+			}
+
+			// 4x4 transpose within each half
+			static void Transpose(Floats& a, Floats& b, Floats& c, Floats& d)
+			{
+				__m256 t0 = _mm256_unpacklo_ps(a.v, b.v), t1 = _mm256_unpackhi_ps(a.v, b.v);
+				__m256 t2 = _mm256_unpacklo_ps(c.v, d.v), t3 = _mm256_unpackhi_ps(c.v, d.v);
+				a.v = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+				b.v = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+				c.v = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+				d.v = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+			}
+
+			friend Floats operator+(Floats a, Floats b) { return { _mm256_add_ps(a.v, b.v) }; }
+			friend Floats operator-(Floats a, Floats b) { return { _mm256_sub_ps(a.v, b.v) }; }
+			friend Floats operator*(Floats a, Floats b) { return { _mm256_mul_ps(a.v, b.v) }; }
+			friend Floats operator/(Floats a, Floats b) { return { _mm256_div_ps(a.v, b.v) }; }
+			friend Floats operator>(Floats a, Floats b)
+			{
+				return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) };
+			}
+			friend Floats operator&(Floats a, Floats b) { return { _mm256_and_ps(a.v, b.v) }; }
+			friend Floats operator|(Floats a, Floats b) { return { _mm256_or_ps(a.v, b.v) }; }
+			friend Floats operator^(Floats a, Floats b) { return { _mm256_xor_ps(a.v, b.v) }; }
+			friend Floats AndNot(Floats a, Floats b) { return { _mm256_andnot_ps(a.v, b.v) }; }
+			friend Floats Sqrt(Floats a) { return { _mm256_sqrt_ps(a.v) }; }
+
+			/* a_mask ? a : b per lane */
+			friend Floats Select(Floats a_mask, Floats a, Floats b)
+			{
+				return { _mm256_blendv_ps(b.v, a.v, a_mask.v) };
+			}
+		};
+#else
+		struct Floats
+		{
+			static constexpr size_t kWidth = 4;
+
+			__m128 v;
+
+			static Floats Set(float a) { return { _mm_set1_ps(a) }; }
+
+			static Floats Gather(const float* a, size_t s)
+			{
+				return { _mm_set_ps(a[3 * s], a[2 * s], a[s], a[0]) };
+			}
+			void Scatter(float* a, size_t s) const
+			{
+				alignas(16) float lanes[kWidth];
+				_mm_store_ps(lanes, v);
+				for (size_t i = 0; i < kWidth; i++) { a[i * s] = lanes[i]; }
+			}
+
+			// a single half, a_stride only applies to the 8 wide form
+			static Floats LoadHalves(const float* a, size_t) { return { _mm_loadu_ps(a) }; }
+			void          StoreHalves(float* a, size_t) const { _mm_storeu_ps(a, v); }
+
+			static void Transpose(Floats& a, Floats& b, Floats& c, Floats& d)
+			{
+				_MM_TRANSPOSE4_PS(a.v, b.v, c.v, d.v);
+			}
+
+			friend Floats operator+(Floats a, Floats b) { return { _mm_add_ps(a.v, b.v) }; }
+			friend Floats operator-(Floats a, Floats b) { return { _mm_sub_ps(a.v, b.v) }; }
+			friend Floats operator*(Floats a, Floats b) { return { _mm_mul_ps(a.v, b.v) }; }
+			friend Floats operator/(Floats a, Floats b) { return { _mm_div_ps(a.v, b.v) }; }
+			friend Floats operator>(Floats a, Floats b) { return { _mm_cmpgt_ps(a.v, b.v) }; }
+			friend Floats operator&(Floats a, Floats b) { return { _mm_and_ps(a.v, b.v) }; }
+			friend Floats operator|(Floats a, Floats b) { return { _mm_or_ps(a.v, b.v) }; }
+			friend Floats operator^(Floats a, Floats b) { return { _mm_xor_ps(a.v, b.v) }; }
+			friend Floats AndNot(Floats a, Floats b) { return { _mm_andnot_ps(a.v, b.v) }; }
+			friend Floats Sqrt(Floats a) { return { _mm_sqrt_ps(a.v) }; }
+
+			// blendv needs SSE4.1
+			friend Floats Select(Floats a_mask, Floats a, Floats b)
+			{
+				return { _mm_or_ps(_mm_and_ps(a_mask.v, a.v), _mm_andnot_ps(a_mask.v, b.v)) };
+			}
+		};
+#endif
+		constexpr size_t kWidth = Floats::kWidth;
+
+		// structure of arrays: w, x, y, z and the matrix entries row by row
+		using Quats = std::array<Floats, 4>;
+		using Mats = std::array<Floats, 9>;
+
+		/* Blocks of kWidth rotations. Lane i is rotation a[i]: with 8 lanes, 4 rows are loaded
+		* per half and each half is transposed on its own
+		*/
+		Quats LoadQuats(const NiQuaternion* a)
+		{
+			Quats q;
+			for (size_t r = 0; r < 4; r++) { q[r] = Floats::LoadHalves(&a[r].w, 16); }
+			Floats::Transpose(q[0], q[1], q[2], q[3]);
+			return q;
+		}
+
+		void StoreQuats(Quats a_q, NiQuaternion* a_out)
+		{
+			Floats::Transpose(a_q[0], a_q[1], a_q[2], a_q[3]);
+			for (size_t r = 0; r < 4; r++) { a_q[r].StoreHalves(&a_out[r].w, 16); }
+		}
+
+#ifdef __AVX2__
+		// entries 0 to 3 and 4 to 7 transposed like quaternions, the last one gathered
+		Mats LoadMats(const NiMatrix3* a)
+		{
+			Mats m;
+			for (size_t first = 0; first < 8; first += 4)
+			{
+				for (size_t r = 0; r < 4; r++)
+				{
+					m[first + r] = Floats::LoadHalves(&a[r].entry[0][0] + first, 36);
+				}
+				Floats::Transpose(m[first], m[first + 1], m[first + 2], m[first + 3]);
+			}
+			m[8] = Floats::Gather(&a[0].entry[2][2], 9);
+			return m;
+		}
+
+		NiMatrix3 Identity(const NiMatrix3*)
+		{
+			return NiMatrix3({ 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 });
+		}
+#endif
+
+		void StoreMats(Mats a_m, NiMatrix3* a_out)
+		{
+			for (size_t first = 0; first < 8; first += 4)
+			{
+				Floats::Transpose(a_m[first], a_m[first + 1], a_m[first + 2], a_m[first + 3]);
+				for (size_t r = 0; r < 4; r++)
+				{
+					a_m[first + r].StoreHalves(&a_out[r].entry[0][0] + first, 36);
+				}
+			}
+			a_m[8].Scatter(&a_out[0].entry[2][2], 9);
+		}
+
+		// pads the last block of each input
+		NiQuaternion Identity(const NiQuaternion*) { return { 1, 0, 0, 0 }; }
+
+		template <typename T>
+		std::array<T, kWidth> Tail(const T* a, size_t a_count)
+		{
+			std::array<T, kWidth> block;
+			block.fill(Identity(a));
+			std::copy_n(a, a_count, block.begin());
+			return block;
+		}
+
+		/* a_block(out, in...) on each full block, then on copies of the last partial one padded
+		* with the identity, so the lanes past the end are not stored
+		*/
+		template <typename Block, typename Out, typename... In>
+		void ForEachBlock(size_t a_count, Block a_block, Out* a_out, const In*... a_in)
+		{
+			size_t i = 0;
+			for (; i + kWidth <= a_count; i += kWidth) { a_block(a_out + i, a_in + i...); }
+			if (i < a_count)
+			{
+				std::array<Out, kWidth> out;
+				a_block(out.data(), Tail(a_in + i, a_count - i).data()...);
+				std::copy_n(out.begin(), a_count - i, a_out + i);
+			}
+		}
+
+		// same operations in the same order as Quat2Mat
+		Mats ToMats(const Quats& a_q)
+		{
+			auto [w, x, y, z] = a_q;
+			Floats xx = x * x, xy = x * y, xz = x * z, xw = x * w;
+			Floats yy = y * y, yz = y * z, yw = y * w;
+			Floats zz = z * z, zw = z * w;
+			Floats one = Floats::Set(1), two = Floats::Set(2);
+
+			return { one - two * (yy + zz), two * (xy - zw), two * (xz + yw),
+				two * (xy + zw), one - two * (xx + zz), two * (yz - xw),
+				two * (xz - yw), two * (yz + xw), one - two * (xx + yy) };
+		}
+
+#ifdef __AVX2__
+		/* Mat2Quat without branches: the branch each lane takes is chosen the same way, then every
+		* component is selected from the candidates. The arithmetic matches, so the result does too
+		*/
+		Quats ToQuats(const Mats& a_m)
+		{
+			auto [m00, m01, m02, m10, m11, m12, m20, m21, m22] = a_m;
+			Floats one = Floats::Set(1);
+			Floats zero = Floats::Set(0);
+
+			Floats trace = m00 + m11 + m22;
+			Floats is_w = trace > zero;
+			Floats is_x = AndNot(is_w, (m00 > m11) & (m00 > m22));
+			Floats is_y = AndNot(is_w | is_x, m11 > m22);
+
+			Floats s = Select(is_w, one + trace,
+				Select(is_x, one + m00 - m11 - m22,
+					Select(is_y, one - m00 + m11 - m22, one - m00 - m11 + m22)));
+			s = Sqrt(s) * Floats::Set(2);
+
+			// rows of Mat2Quat's four results, with n for the numerator of the largest component:
+			// w {n, a, b, c}, x {a, n, d, e}, y {b, d, n, f}, z {c, e, f, n}
+			Floats a = m21 - m12, b = m02 - m20, c = m10 - m01;
+			Floats d = m01 + m10, e = m02 + m20, f = m12 + m21;
+			auto   pick = [&](Floats w_case, Floats x_case, Floats y_case, Floats z_case) {
+				return Select(is_w, w_case, Select(is_x, x_case, Select(is_y, y_case, z_case)));
+			};
+
+			// numerators picked before dividing, 4 divisions instead of 6
+			Floats big = s / Floats::Set(4);
+			return { Select(is_w, big, pick(s, a, b, c) / s),
+				Select(is_x, big, pick(a, s, d, e) / s),
+				Select(is_y, big, pick(b, d, s, f) / s),
+				Select(is_w | is_x | is_y, pick(c, e, f, s) / s, big) };
+		}
+#endif
+
+		// sin on [0, pi/2], Taylor series to x^11, the next term bounds the error by 6e-8
+		Floats SinQuarterTurn(Floats x)
+		{
+			Floats x2 = x * x;
+			Floats p = Floats::Set(-1.f / 39916800);
+			p = p * x2 + Floats::Set(1.f / 362880);
+			p = p * x2 + Floats::Set(-1.f / 5040);
+			p = p * x2 + Floats::Set(1.f / 120);
+			p = p * x2 + Floats::Set(-1.f / 6);
+			p = p * x2 + Floats::Set(1);
+			return x * p;
+		}
+
+		// acos on [0, 1], Abramowitz and Stegun 4.4.46, error 2e-8
+		Floats AcosUnit(Floats x)
+		{
+			Floats p = Floats::Set(-0.0012624911f);
+			p = p * x + Floats::Set(0.0066700901f);
+			p = p * x + Floats::Set(-0.0170881256f);
+			p = p * x + Floats::Set(0.0308918810f);
+			p = p * x + Floats::Set(-0.0501743046f);
+			p = p * x + Floats::Set(0.0889789874f);
+			p = p * x + Floats::Set(-0.2145988016f);
+			p = p * x + Floats::Set(1.5707963050f);
+			return Sqrt(Floats::Set(1) - x) * p;
+		}
+
+		/* QuatSlerp with the weights taken as sin((1 - t) theta_0) / sin(theta_0) and
+		* sin(t theta_0) / sin(theta_0). The polynomials above are accurate to float, unlike the
+		* ENABLE_FAST_TRIG ones, so the batch does not depend on that option
+		*/
+		Quats Slerp(const Quats& a_q1, Quats a_q2, Floats a_interp)
+		{
+			Floats dot =
+				a_q1[0] * a_q2[0] + a_q1[1] * a_q2[1] + a_q1[2] * a_q2[2] + a_q1[3] * a_q2[3];
+
+			// flip q2 onto the shorter arc by its sign bit
+			Floats sign = (Floats::Set(0) > dot) & Floats::Set(-0.f);
+			for (auto& c : a_q2) { c = c ^ sign; }
+			dot = dot ^ sign;
+
+			Floats one = Floats::Set(1);
+			Floats theta_0 = AcosUnit(dot);
+			Floats sin_theta_0 = SinQuarterTurn(theta_0);
+			Floats s0 = SinQuarterTurn((one - a_interp) * theta_0) / sin_theta_0;
+			Floats s1 = SinQuarterTurn(a_interp * theta_0) / sin_theta_0;
+
+			// nearly the same rotation, the weights above divide 0 by 0
+			Floats nearly_same = dot > Floats::Set(0.9995f);
+			s0 = Select(nearly_same, one - a_interp, s0);
+			s1 = Select(nearly_same, a_interp, s1);
+
+			Quats q3;
+			for (size_t c = 0; c < 4; c++) { q3[c] = s0 * a_q1[c] + s1 * a_q2[c]; }
+			Floats length = Sqrt(q3[0] * q3[0] + q3[1] * q3[1] + q3[2] * q3[2] + q3[3] * q3[3]);
+			for (auto& c : q3) { c = c / length; }
+			return q3;
+		}
+	}
+
+	void Mat2QuatBatch(std::span<const NiMatrix3> a_matrices, std::span<NiQuaternion> a_out)
+	{
+#ifdef __AVX2__
+		ForEachBlock(
+			a_matrices.size(),
+			[](NiQuaternion* a_out, const NiMatrix3* a_in) {
+				StoreQuats(ToQuats(LoadMats(a_in)), a_out);
+			},
+			a_out.data(), a_matrices.data());
+#else
+		// 4 wide, computing all four branches costs more than Mat2Quat's predicted branch saves
+		for (size_t i = 0; i < a_matrices.size(); i++) { a_out[i] = Mat2Quat(a_matrices[i]); }
+#endif
+	}
+
+	void Quat2MatBatch(std::span<const NiQuaternion> a_quats, std::span<NiMatrix3> a_out)
+	{
+		ForEachBlock(
+			a_quats.size(),
+			[](NiMatrix3* a_out, const NiQuaternion* a_in) {
+				StoreMats(ToMats(LoadQuats(a_in)), a_out);
+			},
+			a_out.data(), a_quats.data());
+	}
+
+	void QuatSlerpBatch(std::span<const NiQuaternion> a_from, std::span<const NiQuaternion> a_to,
+		float a_interp, std::span<NiQuaternion> a_out)
+	{
+		Floats interp = Floats::Set(a_interp);
+		ForEachBlock(
+			a_from.size(),
+			[interp](NiQuaternion* a_out, const NiQuaternion* a_from, const NiQuaternion* a_to) {
+				StoreQuats(Slerp(LoadQuats(a_from), LoadQuats(a_to), interp), a_out);
+			},
+			a_out.data(), a_from.data(), a_to.data());
+	}
+}
@@ -0,0 +1,147 @@
+#include "trace_log.h"
+
+#include "spsc_ring.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace tracelog
+{
+	// one ring per thread that traces: input, pose and game thread, with room to spare
+	constexpr size_t kMaxThreads = 8;
+	constexpr size_t kRingSize = 512;
+	constexpr auto   kDrainInterval = std::chrono::milliseconds(50);
+
+	std::array<SpscRing<Record, kRingSize>, kMaxThreads> rings;
+	std::atomic<size_t>                                  ring_count = 0;
+	std::atomic<uint64_t>                                unassigned_drops = 0;
+
+	std::atomic<bool> running = false;
+
+	struct WriterThread
+	{
+		std::thread thread;
+
+		~WriterThread()
+		{
+			running.store(false, std::memory_order_release);
+			if (thread.joinable()) { thread.join(); }
+		}
+	};
+	WriterThread writer;
+
+	uint64_t Now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch())
+			.count();
+	}
+
+	void Write(const Record& a_record)
+	{
+		thread_local size_t ring_index = ring_count.fetch_add(1, std::memory_order_acq_rel);
+
+		if (ring_index >= kMaxThreads)
+		{
+			unassigned_drops.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		rings[ring_index].Push(a_record);
+	}
+
+	// checked before the cast, which is undefined for NaN, infinity and anything out of range
+	bool IsInt64(double a_value)
+	{
+		return std::isfinite(a_value) && a_value >= -0x1p63 && a_value < 0x1p63 &&
+			a_value == std::trunc(a_value);
+	}
+
+	std::string Format(const Record& a_record)
+	{
+		if (a_record.event >= Event::kCount) { return "unknown trace event"; }
+
+		auto        format = kEventFormats[(size_t)a_record.event];
+		std::string result;
+		size_t      arg = 0;
+
+		for (size_t i = 0; i < format.size(); i++)
+		{
+			if (format[i] == '{' && i + 1 < format.size() && format[i + 1] == '}')
+			{
+				i++;
+				if (arg >= a_record.argc) { continue; }
+
+				// integers print without a fraction
+				double value = a_record.args[arg++];
+				result +=
+					IsInt64(value) ? std::to_string((int64_t)value) : std::format("{}", value);
+			}
+			else { result += format[i]; }
+		}
+		return result;
+	}
+
+	uint64_t Dropped()
+	{
+		uint64_t total = unassigned_drops.load(std::memory_order_relaxed);
+		for (auto& ring : rings) { total += ring.Dropped(); }
+		return total;
+	}
+
+	void Drain()
+	{
+		static std::vector<Record> batch;
+		static uint64_t            reported_drops = 0;
+
+		Record record;
+		for (auto& ring : rings)
+		{
+			while (ring.Pop(record)) { batch.push_back(record); }
+		}
+
+		if (!batch.empty())
+		{
+			// rings are ordered per thread, merge them by time
+			std::ranges::sort(batch, {}, &Record::timestamp_ns);
+
+			// one log call per batch so the file is flushed once, not per line
+			std::string text;
+			for (auto& r : batch)
+			{
+				text += std::format("\n[{}.{:06}] ", r.timestamp_ns / 1'000'000'000,
+					r.timestamp_ns / 1000 % 1'000'000);
+				text += Format(r);
+			}
+			SKSE::log::trace("trace:{}", text);
+			batch.clear();
+		}
+
+		if (auto dropped = Dropped(); dropped != reported_drops)
+		{
+			SKSE::log::warn("trace: {} records dropped so far", dropped);
+			reported_drops = dropped;
+		}
+	}
+
+	void Start()
+	{
+		if (running.exchange(true)) return;
+
+		writer.thread = std::thread([]() {
+			while (running.load(std::memory_order_acquire))
+			{
+				Drain();
+				std::this_thread::sleep_for(kDrainInterval);
+			}
+			Drain();
+		});
+	}
+
+	void Stop()
+	{
+		if (!running.exchange(false)) return;
+		if (writer.thread.joinable()) { writer.thread.join(); }
+	}
+}
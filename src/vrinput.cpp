@@ -1,492 +1,985 @@
-#include "vrinput.h"
-
-#include "VR/OpenVRUtils.h"
-#include "main_plugin.h"
-#include "menu_checker.h"
-
-namespace vrinput
-{
-	using namespace vr;
-
-	struct InputCallback
-	{
-		Hand              device;
-		ActionType        type;
-		InputCallbackFunc func;
-
-		bool operator==(const InputCallback& a_rhs)
-		{
-			return (device == a_rhs.device) && (type == a_rhs.type) && (func == a_rhs.func);
-		}
-	};
-
-	bool  block_all_inputs = false;
-	bool  smoothing = 0;
-	float joystick_dpad_threshold = 0.7f;
-	float joystick_dpad_threshold_negative = -0.7f;
-	float adjustable = 0.02f;
-
-	std::mutex               callback_lock;
-	vr::TrackedDeviceIndex_t g_leftcontroller;
-	vr::TrackedDeviceIndex_t g_rightcontroller;
-	vr::IVRSystem*           g_IVRSystem = nullptr;
-
-	std::deque<std::pair<ModInputEvent, vr::EVRButtonId>> fake_event_queue_left;
-	std::deque<std::pair<ModInputEvent, vr::EVRButtonId>> fake_event_queue_right;
-
-	vr::VRControllerAxis_t joystick[2] = {};
-	float                  trigger[2];
-
-	// each button id is mapped to a list of callback funcs
-	std::unordered_map<int, std::vector<InputCallback>> callbacks;
-
-	// I'm just going to store these the same way they come in
-	std::array<std::array<uint64_t, 2>, 2> button_states = { { { 0ull, 0ull }, { 0ull, 0ull } } };
-
-	std::vector<ModInputEvent> fake_button_states;
-
-	std::vector<uint16_t>* g_haptic_keyframes_left = nullptr;
-	std::vector<uint16_t>* g_haptic_keyframes_right = nullptr;
-
-	void StartBlockingAll() { block_all_inputs = true; }
-	void StopBlockingAll() { block_all_inputs = false; }
-	bool isBlockingAll() { return block_all_inputs; }
-
-	void StartSmoothing() { smoothing = 1; }
-	void StopSmoothing() { smoothing = 0; }
-
-	ButtonState GetButtonState(
-		vr::EVRButtonId a_button_ID, Hand a_hand, ActionType a_touch_or_press)
-	{
-		return (ButtonState)((
-			bool)(button_states[(int)a_hand][(int)a_touch_or_press] & 1ull << a_button_ID));
-	}
-
-	void AddCallback(const InputCallbackFunc a_callback, const vr::EVRButtonId a_button,
-		const Hand hand, const ActionType touch_or_press)
-	{
-		std::scoped_lock lock(callback_lock);
-		if (!a_callback) return;
-
-		callbacks[a_button].push_back(InputCallback(hand, touch_or_press, a_callback));
-	}
-
-	void RemoveCallback(const InputCallbackFunc a_callback, const vr::EVRButtonId a_button,
-		const Hand hand, const ActionType touch_or_press)
-	{
-		std::scoped_lock lock(callback_lock);
-		if (!a_callback) return;
-
-		auto it = std::find(callbacks[a_button].begin(), callbacks[a_button].end(),
-			InputCallback(hand, touch_or_press, a_callback));
-		if (it != callbacks[a_button].end()) { callbacks[a_button].erase(it); }
-	}
-
-	void AddHoldCallback(const InputCallbackFunc a_callback,
-		const std::chrono::milliseconds a_duration, const vr::EVRButtonId a_button_ID,
-		const Hand a_hand, const ActionType a_touch_or_press)
-	{
-		// TODO AddHoldCallback
-	}
-
-	void RemoveHoldCallback(const InputCallbackFunc a_callback, const vr::EVRButtonId a_button_ID,
-		const Hand a_hand, const ActionType a_touch_or_press)
-	{
-		// TODO RemoveHoldCallback
-	}
-
-	void SendFakeInputEvent(const ModInputEvent a_event)
-	{
-		if (a_event.device == Hand::kLeft)
-		{
-			fake_event_queue_left.push_back(std::make_pair(a_event, a_event.button_ID));
-		}
-		else { fake_event_queue_right.push_back(std::make_pair(a_event, a_event.button_ID)); }
-	}
-
-	void SetFakeButtonState(const ModInputEvent a_event) { fake_button_states.push_back(a_event); }
-
-	void ClearFakeButtonState(const ModInputEvent a_event)
-	{
-		auto it = std::find(fake_button_states.begin(), fake_button_states.end(), a_event);
-		if (it != fake_button_states.end()) { fake_button_states.erase(it); }
-	}
-
-	void ClearAllFake() { fake_button_states.clear(); }
-
-	void ProcessButtonChanges(uint64_t changedMask, uint64_t currentState, bool isLeft, bool touch,
-		vr::VRControllerState_t* out)
-	{
-		// update private button states
-		button_states[isLeft][touch] = currentState;
-
-		// iterate through each of the button codes that we care about
-		for (auto buttonID : all_buttons)
-		{
-			uint64_t bitmask = 1ull << buttonID;
-
-			// check if this button's state has changed and it has any callbacks
-			if (bitmask & changedMask && callbacks.contains(buttonID))
-			{
-				// check whether it was a press or release event
-				bool buttonPress = bitmask & currentState;
-
-				const ModInputEvent event_flags =
-					ModInputEvent(static_cast<Hand>(isLeft), static_cast<ActionType>(touch),
-						static_cast<ButtonState>(buttonPress), buttonID);
-
-				// iterate through callbacks for this button and call if flags match
-				for (auto& cb : callbacks[buttonID])
-				{
-					if (cb.device == event_flags.device && cb.type == event_flags.touch_or_press)
-					{
-						// the callback tells us if we should block the input
-						if (cb.func(event_flags))
-						{
-							if (buttonPress)  // clear the current state of the button
-							{
-								if (touch) { out->ulButtonTouched &= ~bitmask; }
-								else { out->ulButtonPressed &= ~bitmask; }
-							}
-							else  // set the current state of the button
-							{
-								if (touch) { out->ulButtonTouched |= bitmask; }
-								else { out->ulButtonPressed |= bitmask; }
-							}
-						}
-					}
-				}
-			}
-		}
-	}
-
-	/* range: -1.0 to 1.0 for joystick, 0.0 to 1.0 for trigger ( 0 = not touching) */
-	inline void ProcessAxisChanges(
-		const VRControllerAxis_t& a_joystick, const float& a_trigger, bool isLeft)
-	{
-		static std::vector<bool> dpad_buffer[2] = { { false, false, false, false },
-			{ false, false, false, false } };
-
-		std::vector<bool> dpad_temp = {
-			(a_joystick.x < joystick_dpad_threshold_negative),
-			(a_joystick.y > joystick_dpad_threshold),
-			(a_joystick.x > joystick_dpad_threshold),
-			(a_joystick.y < joystick_dpad_threshold_negative),
-		};
-
-		if (dpad_buffer[isLeft] != dpad_temp)
-		{
-			for (int id = 0; id < dpad.size(); id++)
-			{
-				if (dpad_buffer[isLeft][id] != dpad_temp[id])
-				{
-					const ModInputEvent event_flags = ModInputEvent(static_cast<Hand>(isLeft),
-						ActionType::kPress, static_cast<ButtonState>((bool)dpad_temp[id]));
-
-					// iterate through callbacks for this button and call if flags match
-					for (auto& cb : callbacks[id + (int)vr::k_EButton_DPad_Left])
-					{
-						if (cb.device == event_flags.device &&
-							cb.type == event_flags.touch_or_press)
-						{
-							cb.func(event_flags);
-						}
-					}
-				}
-			}
-			dpad_buffer[isLeft] = dpad_temp;
-		}
-
-		trigger[isLeft] = a_trigger;
-		joystick[isLeft] = a_joystick;
-	}
-
-	/* For spoofing button presses. VRTools lets us clear bits but not set them.
-	* see https://github.com/SkyrimAlternativeDevelopers/SkyrimVRTools/blob/master/src/hooks/HookVRSystem.cpp#L91
-	* Writes to all 3 copies of the controller state so that proceeding input callbacks don't overwrite our changes
-	* by default. That means other mods may or may not see the fake button presses depending on the order in which
-	* the callbacks are processed, and if they do, they may clear them.
-	*/
-	struct AsmSetControllerButtons : Xbyak::CodeGenerator
-	{
-		AsmSetControllerButtons()
-		{
-			or_(r12, ptr[rbp - 0x60]);  // touch
-			or_(r13, ptr[rbp - 0x68]);  // press
-
-			mov(ptr[rbp - 0x20], r12);  // touch
-			mov(ptr[rbp - 0x28], r13);  // press
-
-			mov(ptr[rbp - 0xA0], r12);  // touch
-			mov(ptr[rbp - 0xA8], r13);  // press
-
-			ret();
-		}
-	};
-
-	struct AsmSetControllerAxes : Xbyak::CodeGenerator
-	{
-		AsmSetControllerAxes()
-		{
-			// joystick.x (arg1)
-			movss(ptr[rbp - 0x98], xmm0);
-			movss(ptr[rbp - 0x58], xmm0);
-			movss(ptr[rbp - 0x18], xmm0);
-			// joystick.y (arg2)
-			movss(ptr[rbp - 0x94], xmm1);
-			movss(ptr[rbp - 0x54], xmm1);
-			movss(ptr[rbp - 0x14], xmm1);
-			movss(xmm15, xmm1);
-			// trigger (arg3)
-			movss(ptr[rbp - 0x90], xmm2);
-			movss(ptr[rbp - 0x50], xmm2);
-			movss(ptr[rbp - 0x10], xmm2);
-			movss(xmm14, xmm2);
-
-			ret();
-		}
-	};
-
-	AsmSetControllerAxes    code_set_axes;
-	AsmSetControllerButtons code_set_buttons;
-
-	void InitControllerHooks()
-	{
-		code_set_axes.ready();
-
-		code_set_buttons.ready();
-	}
-
-	int   haptic_frame_pos_left = 0;
-	int   haptic_frame_pos_right = 0;
-	float g_haptic_power_left = 1.f;
-	float g_haptic_power_right = 1.f;
-
-	// handles low level button/trigger events
-	bool ControllerInputCallback(vr::TrackedDeviceIndex_t unControllerDeviceIndex,
-		const vr::VRControllerState_t* pControllerState, uint32_t unControllerStateSize,
-		vr::VRControllerState_t* pOutputControllerState)
-	{
-		// save last controller input to only do processing on button changes
-		static uint64_t prev_pressed[2] = {};
-		static uint64_t prev_touched[2] = {};
-
-		// need to remember the last output sent to the game in order to maintain input blocking
-		static uint64_t prev_pressed_out[2] = {};
-		static uint64_t prev_touched_out[2] = {};
-
-		if (pControllerState && !menuchecker::isGameStopped())
-		{
-			bool isLeft = unControllerDeviceIndex == g_leftcontroller;
-			if (isLeft || unControllerDeviceIndex == g_rightcontroller)
-			{
-				uint64_t pressed_change = prev_pressed[isLeft] ^ pControllerState->ulButtonPressed;
-				uint64_t touched_change = prev_touched[isLeft] ^ pControllerState->ulButtonTouched;
-#ifdef PROCESSAXES
-				ProcessAxisChanges(
-					pControllerState->rAxis[0], pControllerState->rAxis[1].x, isLeft);
-#endif
-				if (pressed_change)
-				{
-					ProcessButtonChanges(pressed_change, pControllerState->ulButtonPressed, isLeft,
-						false, pOutputControllerState);
-					prev_pressed[isLeft] = pControllerState->ulButtonPressed;
-					prev_pressed_out[isLeft] = pOutputControllerState->ulButtonPressed;
-				}
-				else { pOutputControllerState->ulButtonPressed = prev_pressed_out[isLeft]; }
-
-				if (touched_change)
-				{
-					ProcessButtonChanges(touched_change, pControllerState->ulButtonTouched, isLeft,
-						true, pOutputControllerState);
-					prev_touched[isLeft] = pControllerState->ulButtonTouched;
-					prev_touched_out[isLeft] = pOutputControllerState->ulButtonTouched;
-				}
-				else { pOutputControllerState->ulButtonTouched = prev_touched_out[isLeft]; }
-
-				if (isBlockingAll())
-				{
-					pOutputControllerState->ulButtonPressed = 0;
-					pOutputControllerState->ulButtonTouched = 0;
-					pOutputControllerState->rAxis->x = 0.0f;
-					pOutputControllerState->rAxis->y = 0.0f;
-				}
-
-				auto local_trigger = pControllerState->rAxis[1].x;
-
-				bool need_to_write_state = !(fake_event_queue_left.empty() &&
-					fake_event_queue_right.empty() && fake_button_states.empty());
-
-				// momentary button spoofing
-				if ((!fake_event_queue_left.empty() && isLeft) ||
-					(!fake_event_queue_right.empty() && !isLeft))
-				{
-					static std::deque<std::pair<ModInputEvent, vr::EVRButtonId>>* spoof_queue;
-					spoof_queue = isLeft ? &fake_event_queue_left : &fake_event_queue_right;
-
-					do {
-						auto&     event = spoof_queue->front();
-						uint64_t* state = event.first.touch_or_press == ActionType::kPress ?
-							&(pOutputControllerState->ulButtonPressed) :
-							&(pOutputControllerState->ulButtonTouched);
-
-						*state = event.first.button_state == ButtonState::kButtonDown ?
-							*state | 1ull << event.second :
-							*state & ~(1ull << event.second);
-
-						if (event.second == k_EButton_SteamVR_Trigger)
-						{
-							if (event.first.button_state == ButtonState::kButtonDown &&
-								event.first.touch_or_press == ActionType::kPress)
-							{
-								local_trigger = 1.f;
-							}
-							else { local_trigger = 0.f; }
-						}
-
-						spoof_queue->pop_front();
-
-					} while (!spoof_queue->empty());
-				}
-
-				// hold button spoofing
-				for (auto& event : fake_button_states)
-				{
-					if (isLeft == (bool)event.device)
-					{
-						uint64_t* state = event.touch_or_press == ActionType::kPress ?
-							&(pOutputControllerState->ulButtonPressed) :
-							&(pOutputControllerState->ulButtonTouched);
-
-						*state = event.button_state == ButtonState::kButtonDown ?
-							*state | 1ull << event.button_ID :
-							*state & ~(1ull << event.button_ID);
-
-						if (event.button_ID == k_EButton_SteamVR_Trigger &&
-							event.touch_or_press == ActionType::kPress)
-						{
-							if (event.button_state == ButtonState::kButtonDown)
-							{
-								local_trigger = 1.f;
-							}
-							else { local_trigger = 0.f; }
-						}
-					}
-				}
-
-				if (block_all_inputs)
-				{
-					pOutputControllerState->ulButtonPressed = 0;
-					pOutputControllerState->ulButtonTouched = 0;
-					pOutputControllerState->rAxis[0].x = 0.0;
-					pOutputControllerState->rAxis[0].y = 0.0;
-					local_trigger = 0.0;
-				}
-
-				if (need_to_write_state)
-				{
-					auto SetControllerAxesFunc =
-						code_set_axes.getCode<void (*)(float, float, float)>();
-					auto SetControllerButtonsFunc = code_set_buttons.getCode<void (*)(void)>();
-
-					SetControllerAxesFunc(pOutputControllerState->rAxis[0].x,
-						pOutputControllerState->rAxis[0].y, local_trigger);
-
-					SetControllerButtonsFunc();
-				}
-			}
-		}
-		return true;
-	}
-
-	bool                         overlapping = false;
-	PapyrusVR::TrackedDevicePose bow;
-	PapyrusVR::TrackedDevicePose arrow;
-
-	// handles device poses and generates haptic events (For now)
-	vr::EVRCompositorError ControllerPoseCallback(VR_ARRAY_COUNT(unRenderPoseArrayCount)
-													  vr::TrackedDevicePose_t* pRenderPoseArray,
-		uint32_t                                                      unRenderPoseArrayCount,
-		VR_ARRAY_COUNT(unGamePoseArrayCount) vr::TrackedDevicePose_t* pGamePoseArray,
-		uint32_t                                                      unGamePoseArrayCount)
-	{
-		using namespace PapyrusVR;
-
-		arrownock::OnUpdate();
-
-		if (g_haptic_keyframes_left)
-		{
-			if (haptic_frame_pos_left < g_haptic_keyframes_left->size())
-			{
-				g_IVRSystem->TriggerHapticPulse(g_leftcontroller, 0,
-					g_haptic_keyframes_left->at(haptic_frame_pos_left) * g_haptic_power_left);
-				haptic_frame_pos_left++;
-			}
-			else { g_haptic_keyframes_left = nullptr; }
-		}
-		if (g_haptic_keyframes_right)
-		{
-			if (haptic_frame_pos_right < g_haptic_keyframes_right->size())
-			{
-				g_IVRSystem->TriggerHapticPulse(g_rightcontroller, 0,
-					g_haptic_keyframes_right->at(haptic_frame_pos_right) * g_haptic_power_right);
-				haptic_frame_pos_right++;
-			}
-			else { g_haptic_keyframes_right = nullptr; }
-		}
-
-		return vr::EVRCompositorError::VRCompositorError_None;
-	}
-
-	void Vibrate(bool isLeft, std::vector<uint16_t>* keyframes, float a_power)
-	{
-		if (isLeft)
-		{
-			g_haptic_keyframes_left = keyframes;
-			haptic_frame_pos_left = 0;
-			g_haptic_power_left = std::clamp(a_power, 0.1f, 1.0f);
-		}
-		else
-		{
-			g_haptic_keyframes_right = keyframes;
-			haptic_frame_pos_right = 0;
-			g_haptic_power_right = std::clamp(a_power, 0.1f, 1.0f);
-		}
-	}
-
-	RE::NiTransform HmdMatrixToNiTransform(const HmdMatrix34_t& hmdMatrix)
-	{
-		RE::NiTransform niTransform;
-
-		// Copy rotation matrix
-		for (int i = 0; i < 3; ++i)
-		{
-			for (int j = 0; j < 3; ++j) { niTransform.rotate.entry[i][j] = hmdMatrix.m[i][j]; }
-		}
-
-		// Copy translation vector
-		niTransform.translate.x = hmdMatrix.m[0][3];
-		niTransform.translate.y = hmdMatrix.m[1][3];
-		niTransform.translate.z = hmdMatrix.m[2][3];
-
-		return niTransform;
-	}
-
-	HmdMatrix34_t NiTransformToHmdMatrix(const RE::NiTransform& niTransform)
-	{
-		HmdMatrix34_t hmdMatrix;
-
-		// Copy rotation matrix
-		for (int i = 0; i < 3; ++i)
-		{
-			for (int j = 0; j < 3; ++j) { hmdMatrix.m[i][j] = niTransform.rotate.entry[i][j]; }
-		}
-
-		// Copy translation vector
-		hmdMatrix.m[0][3] = niTransform.translate.x;
-		hmdMatrix.m[1][3] = niTransform.translate.y;
-		hmdMatrix.m[2][3] = niTransform.translate.z;
-
-		return hmdMatrix;
-	}
-}
+#include "vrinput.h"
+
+#include "VR/OpenVRUtils.h"
+#include "main_plugin.h"
+#include "menu_checker.h"
+#include "profiler.h"
+#include "snapshot.h"
+#include "spsc_ring.h"
+
+#include <bit>
+
+namespace vrinput
+{
+	using namespace vr;
+
+	constexpr uint64_t kAllButtonsMask = [] {
+		uint64_t mask = 0;
+		for (auto b : all_buttons) { mask |= 1ull << b; }
+		return mask;
+	}();
+
+	constexpr uint64_t kDpadMask = [] {
+		uint64_t mask = 0;
+		for (auto b : dpad) { mask |= 1ull << b; }
+		return mask;
+	}();
+
+	// a dpad direction engages when the stick component along it exceeds this fraction of the stick
+	// radius (cos 67.5 deg, so diagonals press two directions) and releases below the second one
+	constexpr float kDpadEngageRatio = 0.383f;
+	constexpr float kDpadReleaseRatio = 0.259f;
+
+	// one slot per button x hand x action type
+	constexpr size_t kCallbackSlots = vr::k_EButton_Max * 2 * 2;
+
+	struct HoldCallback
+	{
+		InputCallbackFunc         func;
+		std::chrono::milliseconds duration;
+	};
+
+	struct CallbackTable
+	{
+		std::array<std::vector<InputCallbackFunc>, kCallbackSlots> slots;
+		std::array<std::vector<HoldCallback>, kCallbackSlots>      hold_slots;
+
+		// bit is set for each button that has at least one callback, indexed [hand][touch]
+		uint64_t registered[2][2] = {};
+		uint64_t hold_registered[2][2] = {};
+	};
+
+	inline size_t CallbackSlot(int a_button_ID, bool isLeft, bool touch)
+	{
+		return ((size_t)a_button_ID << 2) | ((size_t)isLeft << 1) | (size_t)touch;
+	}
+
+	using HoldClock = std::chrono::steady_clock;
+
+	// a hold timer armed by the input thread on a press edge
+	struct HoldTimer
+	{
+		HoldClock::time_point deadline;
+		InputCallbackFunc     func = nullptr;
+		uint32_t              slot = 0;
+		uint32_t              generation = 0;
+	};
+
+	// bumped on every press and release of a slot that has hold callbacks. Timers armed under an
+	// older generation are stale, so a release cancels them without touching the wheel
+	std::array<std::atomic<uint32_t>, kCallbackSlots> hold_generation = {};
+
+	/* Hashed timer wheel for hold callbacks, only used from the pose thread. Timers are bucketed by
+	* deadline tick, so advancing it only visits the buckets of the ticks that elapsed since the last
+	* frame no matter how many holds are registered or pending.
+	*/
+	class HoldTimerWheel
+	{
+	public:
+		static constexpr auto     kTick = std::chrono::milliseconds(10);
+		static constexpr size_t   kBuckets = 128;
+		static constexpr size_t   kCapacity = 64;
+		static constexpr uint16_t kNone = 0xffff;
+
+		HoldTimerWheel()
+		{
+			for (uint16_t i = 0; i < kCapacity; i++)
+			{
+				pool[i].next = i + 1 < kCapacity ? i + 1 : kNone;
+			}
+			buckets.fill(kNone);
+		}
+
+		/* returns: false if the wheel is full */
+		bool Insert(const HoldTimer& a_timer)
+		{
+			if (free_head == kNone) { return false; }
+
+			uint16_t index = free_head;
+			free_head = pool[index].next;
+
+			// a deadline that already passed goes into the next bucket to be visited
+			int64_t tick = std::max(TickOf(a_timer.deadline), last_tick + 1);
+
+			pool[index].timer = a_timer;
+			pool[index].next = buckets[tick % kBuckets];
+			buckets[tick % kBuckets] = index;
+			return true;
+		}
+
+		/* Visits every tick that completed since the last call. Expired timers are passed to
+		* a_on_expired, stale ones are dropped
+		*/
+		template <typename F>
+		void Advance(HoldClock::time_point a_now, F&& a_on_expired)
+		{
+			int64_t done = TickOf(a_now) - 1;
+			if (last_tick < 0) { last_tick = done; }
+
+			// after a stall longer than one revolution every bucket is still visited only once
+			for (int64_t tick = std::max(last_tick + 1, done - (int64_t)kBuckets + 1); tick <= done;
+				 tick++)
+			{
+				uint16_t* link = &buckets[tick % kBuckets];
+				while (*link != kNone)
+				{
+					auto& node = pool[*link];
+					bool  stale = hold_generation[node.timer.slot].load(std::memory_order_acquire) !=
+						node.timer.generation;
+
+					if (stale || TickOf(node.timer.deadline) <= tick)
+					{
+						if (!stale) { a_on_expired(node.timer); }
+
+						uint16_t index = *link;
+						*link = node.next;
+						node.next = free_head;
+						free_head = index;
+					}
+					else { link = &node.next; }
+				}
+			}
+			last_tick = std::max(last_tick, done);
+		}
+
+	private:
+		struct Node
+		{
+			HoldTimer timer;
+			uint16_t  next = kNone;
+		};
+
+		static int64_t TickOf(HoldClock::time_point a_time)
+		{
+			return a_time.time_since_epoch() / kTick;
+		}
+
+		std::array<Node, kCapacity>     pool;
+		std::array<uint16_t, kBuckets> buckets;
+		uint16_t                        free_head = 0;
+		int64_t                         last_tick = -1;
+	};
+
+	bool              block_all_inputs = false;
+	std::atomic<bool> smoothing = false;
+	float             dpad_press_radius = 0.7f;
+	float             dpad_release_radius = 0.5f;
+	float             adjustable = 0.02f;
+
+	vr::TrackedDeviceIndex_t g_leftcontroller;
+	vr::TrackedDeviceIndex_t g_rightcontroller;
+	vr::IVRSystem*           g_IVRSystem = nullptr;
+
+	// momentary fake events, indexed by hand. Filled by SendFakeInputEvent and drained by the input
+	// thread on the next poll of that controller
+	SpscRing<ModInputEvent, 16> fake_event_queue[2];
+
+	vr::VRControllerAxis_t joystick[2] = {};
+	float                  trigger[2] = {};
+
+	// copies of the controller game poses, indexed by hand. Pose thread only
+	vr::TrackedDevicePose_t controller_poses[2] = {};
+
+	// One Euro filter (Casiez et al. 2012): a low pass whose cutoff rises with speed. Speed is the
+	// tracker's own velocity rather than a filtered derivative, which would lag behind the motion
+	constexpr float kSmoothMinCutoff = 1.f;     // Hz, for a still hand
+	constexpr float kSmoothBeta = 30.f;         // Hz per m/s
+	constexpr float kSmoothAngularBeta = 10.f;  // Hz per rad/s
+	constexpr float kSmoothMaxGap = 0.1f;       // s, the filter restarts after a longer gap
+
+	// indexed by hand. Pose thread only
+	PoseFilter pose_filters[2];
+
+	// emulated dpad state per hand, bit n is set while dpad[n] is held
+	uint8_t dpad_state[2] = {};
+
+	// set once the runtime reports dpad bits itself (opencomposite), emulation then stays off
+	bool runtime_dpad[2] = {};
+
+	// published as a whole on every add/remove, so the input thread never sees a partial update
+	Snapshot<CallbackTable> callbacks;
+
+	// input thread -> pose thread
+	SpscRing<HoldTimer, 64> hold_arm_queue;
+	HoldTimerWheel          hold_timers;
+
+	// I'm just going to store these the same way they come in
+	std::array<std::array<uint64_t, 2>, 2> button_states = { { { 0ull, 0ull }, { 0ull, 0ull } } };
+
+	// persistent fake state of one hand, applied on every poll as out = (out | set) & ~clear
+	struct FakeButtonMasks
+	{
+		std::atomic<uint64_t> pressed_set = 0;
+		std::atomic<uint64_t> pressed_clear = 0;
+		std::atomic<uint64_t> touched_set = 0;
+		std::atomic<uint64_t> touched_clear = 0;
+		// trigger axis override, negative if none
+		std::atomic<float> trigger = -1.f;
+
+		bool HasOverrides() const
+		{
+			return (pressed_set.load(std::memory_order_relaxed) |
+					   pressed_clear.load(std::memory_order_relaxed) |
+					   touched_set.load(std::memory_order_relaxed) |
+					   touched_clear.load(std::memory_order_relaxed)) != 0 ||
+				trigger.load(std::memory_order_relaxed) >= 0.f;
+		}
+	};
+
+	// indexed by hand, only written by SetFakeButtonState/ClearFakeButtonState/ClearAllFake
+	FakeButtonMasks fake_button_states[2];
+	std::mutex      fake_state_lock;
+
+	void StartBlockingAll() { block_all_inputs = true; }
+	void StopBlockingAll() { block_all_inputs = false; }
+	bool isBlockingAll() { return block_all_inputs; }
+
+	void StartSmoothing() { smoothing.store(true, std::memory_order_relaxed); }
+	void StopSmoothing() { smoothing.store(false, std::memory_order_relaxed); }
+
+	void SetDpadThresholds(float a_press_radius, float a_release_radius)
+	{
+		dpad_press_radius = std::clamp(a_press_radius, 0.1f, 1.f);
+		dpad_release_radius = std::clamp(a_release_radius, 0.05f, dpad_press_radius);
+	}
+
+	const float GetTrigger(Hand a) { return trigger[a == Hand::kLeft]; }
+
+	const vr::VRControllerAxis_t& GetJoystick(Hand a) { return joystick[a == Hand::kLeft]; }
+
+	ButtonState GetButtonState(
+		vr::EVRButtonId a_button_ID, Hand a_hand, ActionType a_touch_or_press)
+	{
+		return (ButtonState)((
+			bool)(button_states[(int)a_hand][(int)a_touch_or_press] & 1ull << a_button_ID));
+	}
+
+	void AddCallback(const InputCallbackFunc a_callback, const vr::EVRButtonId a_button,
+		const Hand hand, const ActionType touch_or_press)
+	{
+		if (!a_callback || a_button >= vr::k_EButton_Max) return;
+
+		bool touch = touch_or_press == ActionType::kTouch;
+
+		callbacks.Update([&](CallbackTable& table) {
+			for (bool isLeft : { false, true })
+			{
+				if (hand == Hand::kBoth || (bool)hand == isLeft)
+				{
+					table.slots[CallbackSlot(a_button, isLeft, touch)].push_back(a_callback);
+					table.registered[isLeft][touch] |= 1ull << a_button;
+				}
+			}
+		});
+	}
+
+	void RemoveCallback(const InputCallbackFunc a_callback, const vr::EVRButtonId a_button,
+		const Hand hand, const ActionType touch_or_press)
+	{
+		if (!a_callback || a_button >= vr::k_EButton_Max) return;
+
+		bool touch = touch_or_press == ActionType::kTouch;
+
+		callbacks.Update([&](CallbackTable& table) {
+			for (bool isLeft : { false, true })
+			{
+				if (hand == Hand::kBoth || (bool)hand == isLeft)
+				{
+					auto& slot = table.slots[CallbackSlot(a_button, isLeft, touch)];
+
+					auto it = std::find(slot.begin(), slot.end(), a_callback);
+					if (it != slot.end()) { slot.erase(it); }
+					if (slot.empty()) { table.registered[isLeft][touch] &= ~(1ull << a_button); }
+				}
+			}
+		});
+	}
+
+	void AddHoldCallback(const InputCallbackFunc a_callback,
+		const std::chrono::milliseconds a_duration, const vr::EVRButtonId a_button_ID,
+		const Hand a_hand, const ActionType a_touch_or_press)
+	{
+		if (!a_callback || a_button_ID >= vr::k_EButton_Max) return;
+
+		bool touch = a_touch_or_press == ActionType::kTouch;
+
+		callbacks.Update([&](CallbackTable& table) {
+			for (bool isLeft : { false, true })
+			{
+				if (a_hand == Hand::kBoth || (bool)a_hand == isLeft)
+				{
+					table.hold_slots[CallbackSlot(a_button_ID, isLeft, touch)].push_back(
+						{ a_callback, a_duration });
+					table.hold_registered[isLeft][touch] |= 1ull << a_button_ID;
+				}
+			}
+		});
+	}
+
+	void RemoveHoldCallback(const InputCallbackFunc a_callback, const vr::EVRButtonId a_button_ID,
+		const Hand a_hand, const ActionType a_touch_or_press)
+	{
+		if (!a_callback || a_button_ID >= vr::k_EButton_Max) return;
+
+		bool touch = a_touch_or_press == ActionType::kTouch;
+
+		callbacks.Update([&](CallbackTable& table) {
+			for (bool isLeft : { false, true })
+			{
+				if (a_hand == Hand::kBoth || (bool)a_hand == isLeft)
+				{
+					auto& slot = table.hold_slots[CallbackSlot(a_button_ID, isLeft, touch)];
+
+					std::erase_if(slot, [&](const HoldCallback& h) { return h.func == a_callback; });
+					if (slot.empty())
+					{
+						table.hold_registered[isLeft][touch] &= ~(1ull << a_button_ID);
+					}
+				}
+			}
+		});
+	}
+
+	/* Arms or cancels the hold timers of every changed button that has hold callbacks */
+	void ProcessHoldChanges(
+		const CallbackTable& a_table, uint64_t a_changed, uint64_t a_current, bool isLeft, bool touch)
+	{
+		auto now = HoldClock::now();
+
+		while (a_changed)
+		{
+			int buttonID = std::countr_zero(a_changed);
+			a_changed &= a_changed - 1;
+
+			auto slot = CallbackSlot(buttonID, isLeft, touch);
+			auto generation = hold_generation[slot].fetch_add(1, std::memory_order_acq_rel) + 1;
+
+			// release only needs the generation bump
+			if (!(a_current & (1ull << buttonID))) { continue; }
+
+			for (auto& hold : a_table.hold_slots[slot])
+			{
+				if (!hold_arm_queue.Push({ .deadline = now + hold.duration,
+						.func = hold.func,
+						.slot = (uint32_t)slot,
+						.generation = generation }))
+				{
+					SKSE::log::warn("hold timer queue full, dropped timer for button {}", buttonID);
+				}
+			}
+		}
+	}
+
+	/* Cancels the pending hold timers of a controller whose button changes are not being seen, so
+	* a button released meanwhile does not fire its hold later
+	*/
+	void CancelHoldTimers(bool isLeft)
+	{
+		auto table = callbacks.Read();
+		for (bool touch : { false, true })
+		{
+			for (uint64_t held = table->hold_registered[isLeft][touch]; held; held &= held - 1)
+			{
+				auto slot = CallbackSlot(std::countr_zero(held), isLeft, touch);
+				hold_generation[slot].fetch_add(1, std::memory_order_acq_rel);
+			}
+		}
+	}
+
+	/* Called once per frame from the pose thread */
+	void AdvanceHoldTimers()
+	{
+		HoldTimer timer;
+		while (hold_arm_queue.Pop(timer))
+		{
+			if (!hold_timers.Insert(timer))
+			{
+				SKSE::log::warn("too many hold timers pending, dropped one for slot {}", timer.slot);
+			}
+		}
+
+		hold_timers.Advance(HoldClock::now(), [](const HoldTimer& a_timer) {
+			auto table = callbacks.Read();
+
+			// the callback may have been removed after the timer was armed
+			auto& registered = table->hold_slots[a_timer.slot];
+			if (std::ranges::none_of(
+					registered, [&](const HoldCallback& h) { return h.func == a_timer.func; }))
+			{
+				return;
+			}
+
+			bool isLeft = (a_timer.slot >> 1) & 1;
+			bool touch = a_timer.slot & 1;
+
+			a_timer.func(ModInputEvent(static_cast<Hand>(isLeft), static_cast<ActionType>(touch),
+				ButtonState::kButtonDown, static_cast<vr::EVRButtonId>(a_timer.slot >> 2)));
+		});
+	}
+
+	void SendFakeInputEvent(const ModInputEvent a_event)
+	{
+		auto& queue = fake_event_queue[a_event.device == Hand::kLeft];
+		if (!queue.Push(a_event))
+		{
+			SKSE::log::warn("fake input queue full, dropped event for button {} ({} total)",
+				(int)a_event.button_ID, queue.Dropped());
+		}
+	}
+
+	void SetFakeButtonState(const ModInputEvent a_event)
+	{
+		if (a_event.button_ID >= vr::k_EButton_Max) return;
+
+		std::scoped_lock lock(fake_state_lock);
+
+		uint64_t bitmask = 1ull << a_event.button_ID;
+		bool     press = a_event.touch_or_press == ActionType::kPress;
+		bool     down = a_event.button_state == ButtonState::kButtonDown;
+
+		for (bool isLeft : { false, true })
+		{
+			if (a_event.device != Hand::kBoth && (bool)a_event.device != isLeft) continue;
+
+			auto& masks = fake_button_states[isLeft];
+			auto& set = press ? masks.pressed_set : masks.touched_set;
+			auto& clear = press ? masks.pressed_clear : masks.touched_clear;
+
+			if (down)
+			{
+				clear.fetch_and(~bitmask, std::memory_order_release);
+				set.fetch_or(bitmask, std::memory_order_release);
+			}
+			else
+			{
+				set.fetch_and(~bitmask, std::memory_order_release);
+				clear.fetch_or(bitmask, std::memory_order_release);
+			}
+
+			if (press && a_event.button_ID == k_EButton_SteamVR_Trigger)
+			{
+				masks.trigger.store(down ? 1.f : 0.f, std::memory_order_release);
+			}
+		}
+	}
+
+	void ClearFakeButtonState(const ModInputEvent a_event)
+	{
+		if (a_event.button_ID >= vr::k_EButton_Max) return;
+
+		std::scoped_lock lock(fake_state_lock);
+
+		uint64_t bitmask = 1ull << a_event.button_ID;
+		bool     press = a_event.touch_or_press == ActionType::kPress;
+		bool     down = a_event.button_state == ButtonState::kButtonDown;
+
+		for (bool isLeft : { false, true })
+		{
+			if (a_event.device != Hand::kBoth && (bool)a_event.device != isLeft) continue;
+
+			auto& masks = fake_button_states[isLeft];
+			auto& overrides = down ? (press ? masks.pressed_set : masks.touched_set) :
+									 (press ? masks.pressed_clear : masks.touched_clear);
+
+			// only clear an override of the same state
+			if ((overrides.fetch_and(~bitmask, std::memory_order_release) & bitmask) &&
+				press && a_event.button_ID == k_EButton_SteamVR_Trigger)
+			{
+				masks.trigger.store(-1.f, std::memory_order_release);
+			}
+		}
+	}
+
+	void ClearAllFake()
+	{
+		std::scoped_lock lock(fake_state_lock);
+
+		for (auto& masks : fake_button_states)
+		{
+			masks.pressed_set.store(0, std::memory_order_release);
+			masks.pressed_clear.store(0, std::memory_order_release);
+			masks.touched_set.store(0, std::memory_order_release);
+			masks.touched_clear.store(0, std::memory_order_release);
+			masks.trigger.store(-1.f, std::memory_order_release);
+		}
+	}
+
+	void ProcessButtonChanges(uint64_t changedMask, uint64_t currentState, bool isLeft, bool touch,
+		vr::VRControllerState_t* out)
+	{
+		// update private button states
+		button_states[isLeft][touch] = currentState;
+
+		auto table = callbacks.Read();
+
+		// only the buttons we care about that changed and have callbacks for this hand and type
+		uint64_t allowed = runtime_dpad[isLeft] ? kAllButtonsMask | kDpadMask : kAllButtonsMask;
+		uint64_t pending = changedMask & table->registered[isLeft][touch] & allowed;
+
+		if (uint64_t hold_changed = changedMask & table->hold_registered[isLeft][touch] & allowed)
+		{
+			ProcessHoldChanges(*table, hold_changed, currentState, isLeft, touch);
+		}
+
+		while (pending)
+		{
+			auto     buttonID = static_cast<vr::EVRButtonId>(std::countr_zero(pending));
+			uint64_t bitmask = 1ull << buttonID;
+			pending &= pending - 1;
+
+			// check whether it was a press or release event
+			bool buttonPress = bitmask & currentState;
+
+			const ModInputEvent event_flags =
+				ModInputEvent(static_cast<Hand>(isLeft), static_cast<ActionType>(touch),
+					static_cast<ButtonState>(buttonPress), buttonID);
+
+			for (auto func : table->slots[CallbackSlot(buttonID, isLeft, touch)])
+			{
+				// the callback tells us if we should block the input
+				if (func(event_flags))
+				{
+					if (buttonPress)  // clear the current state of the button
+					{
+						if (touch) { out->ulButtonTouched &= ~bitmask; }
+						else { out->ulButtonPressed &= ~bitmask; }
+					}
+					else  // set the current state of the button
+					{
+						if (touch) { out->ulButtonTouched |= bitmask; }
+						else { out->ulButtonPressed |= bitmask; }
+					}
+				}
+			}
+		}
+	}
+
+	/* returns the dpad directions held by a_joystick given the previous state. Uses a radial
+	* deadzone with separate press and release radii so the stick can rest near the edge without
+	* chattering.
+	*/
+	inline uint8_t ComputeDpad(const VRControllerAxis_t& a_joystick, uint8_t a_prev)
+	{
+		float radius_squared = a_joystick.x * a_joystick.x + a_joystick.y * a_joystick.y;
+		float deadzone = a_prev ? dpad_release_radius : dpad_press_radius;
+		if (radius_squared < deadzone * deadzone) { return 0; }
+
+		float radius = std::sqrt(radius_squared);
+
+		// same order as dpad: left, up, right, down
+		const float component[4] = { -a_joystick.x, a_joystick.y, a_joystick.x, -a_joystick.y };
+
+		uint8_t next = 0;
+		for (int id = 0; id < dpad.size(); id++)
+		{
+			float ratio = (a_prev & (1 << id)) ? kDpadReleaseRatio : kDpadEngageRatio;
+			if (component[id] > ratio * radius) { next |= 1 << id; }
+		}
+		return next;
+	}
+
+	/* range: -1.0 to 1.0 for joystick, 0.0 to 1.0 for trigger ( 0 = not touching) */
+	inline void ProcessAxisChanges(
+		const VRControllerAxis_t& a_joystick, const float& a_trigger, bool isLeft)
+	{
+		trigger[isLeft] = a_trigger;
+		joystick[isLeft] = a_joystick;
+
+		uint8_t next = runtime_dpad[isLeft] ? 0 : ComputeDpad(a_joystick, dpad_state[isLeft]);
+		uint8_t changed = next ^ dpad_state[isLeft];
+		if (!changed) { return; }
+
+		dpad_state[isLeft] = next;
+
+		auto table = callbacks.Read();
+
+		for (int id = 0; id < dpad.size(); id++)
+		{
+			if (changed & (1 << id))
+			{
+				const ModInputEvent event_flags = ModInputEvent(static_cast<Hand>(isLeft),
+					ActionType::kPress, static_cast<ButtonState>((bool)(next & (1 << id))),
+					dpad[id]);
+
+				for (auto func : table->slots[CallbackSlot(dpad[id], isLeft, false)])
+				{
+					func(event_flags);
+				}
+			}
+		}
+	}
+
+	/* For spoofing button presses. VRTools lets us clear bits but not set them.
+	* see https://github.com/SkyrimAlternativeDevelopers/SkyrimVRTools/blob/master/src/hooks/HookVRSystem.cpp#L91
+	* Writes to all 3 copies of the controller state so that proceeding input callbacks don't overwrite our changes
+	* by default. That means other mods may or may not see the fake button presses depending on the order in which
+	* the callbacks are processed, and if they do, they may clear them.
+	*/
+	struct AsmSetControllerButtons : Xbyak::CodeGenerator
+	{
+		AsmSetControllerButtons()
+		{
+			or_(r12, ptr[rbp - 0x60]);  // touch
+			or_(r13, ptr[rbp - 0x68]);  // press
+
+			mov(ptr[rbp - 0x20], r12);  // touch
+			mov(ptr[rbp - 0x28], r13);  // press
+
+			mov(ptr[rbp - 0xA0], r12);  // touch
+			mov(ptr[rbp - 0xA8], r13);  // press
+
+			ret();
+		}
+	};
+
+	struct AsmSetControllerAxes : Xbyak::CodeGenerator
+	{
+		AsmSetControllerAxes()
+		{
+			// joystick.x (arg1)
+			movss(ptr[rbp - 0x98], xmm0);
+			movss(ptr[rbp - 0x58], xmm0);
+			movss(ptr[rbp - 0x18], xmm0);
+			// joystick.y (arg2)
+			movss(ptr[rbp - 0x94], xmm1);
+			movss(ptr[rbp - 0x54], xmm1);
+			movss(ptr[rbp - 0x14], xmm1);
+			movss(xmm15, xmm1);
+			// trigger (arg3)
+			movss(ptr[rbp - 0x90], xmm2);
+			movss(ptr[rbp - 0x50], xmm2);
+			movss(ptr[rbp - 0x10], xmm2);
+			movss(xmm14, xmm2);
+
+			ret();
+		}
+	};
+
+	AsmSetControllerAxes    code_set_axes;
+	AsmSetControllerButtons code_set_buttons;
+
+	// resolved once in InitControllerHooks. While null (no hooks / no OpenVR runtime), the input
+	// callback still runs its full processing but skips the final write into the caller's stack
+	SetControllerAxesFunc    g_set_controller_axes = nullptr;
+	SetControllerButtonsFunc g_set_controller_buttons = nullptr;
+
+	void InitControllerHooks()
+	{
+		code_set_axes.ready();
+		code_set_buttons.ready();
+
+		g_set_controller_axes = code_set_axes.getCode<SetControllerAxesFunc>();
+		g_set_controller_buttons = code_set_buttons.getCode<SetControllerButtonsFunc>();
+	}
+
+	// handles low level button/trigger events
+	bool ControllerInputCallback(vr::TrackedDeviceIndex_t unControllerDeviceIndex,
+		const vr::VRControllerState_t* pControllerState, uint32_t unControllerStateSize,
+		vr::VRControllerState_t* pOutputControllerState)
+	{
+		PROFILE_SCOPE(kInputCallback);
+
+		// save last controller input to only do processing on button changes
+		static uint64_t prev_pressed[2] = {};
+		static uint64_t prev_touched[2] = {};
+
+		// need to remember the last output sent to the game in order to maintain input blocking
+		static uint64_t prev_pressed_out[2] = {};
+		static uint64_t prev_touched_out[2] = {};
+
+		if (pControllerState && menuchecker::isGameStopped())
+		{
+			// button changes are not processed during the menu, so a release would not cancel
+			if (unControllerDeviceIndex == g_leftcontroller) { CancelHoldTimers(true); }
+			else if (unControllerDeviceIndex == g_rightcontroller) { CancelHoldTimers(false); }
+		}
+		else if (pControllerState)
+		{
+			bool isLeft = unControllerDeviceIndex == g_leftcontroller;
+			if (isLeft || unControllerDeviceIndex == g_rightcontroller)
+			{
+				uint64_t pressed_change = prev_pressed[isLeft] ^ pControllerState->ulButtonPressed;
+				uint64_t touched_change = prev_touched[isLeft] ^ pControllerState->ulButtonTouched;
+				if ((pControllerState->ulButtonPressed & kDpadMask) && !runtime_dpad[isLeft])
+				{
+					SKSE::log::info("runtime generates dpad events, disabling dpad emulation");
+					runtime_dpad[isLeft] = true;
+				}
+				ProcessAxisChanges(
+					pControllerState->rAxis[0], pControllerState->rAxis[1].x, isLeft);
+				if (pressed_change)
+				{
+					ProcessButtonChanges(pressed_change, pControllerState->ulButtonPressed, isLeft,
+						false, pOutputControllerState);
+					prev_pressed[isLeft] = pControllerState->ulButtonPressed;
+					prev_pressed_out[isLeft] = pOutputControllerState->ulButtonPressed;
+				}
+				else { pOutputControllerState->ulButtonPressed = prev_pressed_out[isLeft]; }
+
+				if (touched_change)
+				{
+					ProcessButtonChanges(touched_change, pControllerState->ulButtonTouched, isLeft,
+						true, pOutputControllerState);
+					prev_touched[isLeft] = pControllerState->ulButtonTouched;
+					prev_touched_out[isLeft] = pOutputControllerState->ulButtonTouched;
+				}
+				else { pOutputControllerState->ulButtonTouched = prev_touched_out[isLeft]; }
+
+				if (isBlockingAll())
+				{
+					pOutputControllerState->ulButtonPressed = 0;
+					pOutputControllerState->ulButtonTouched = 0;
+					pOutputControllerState->rAxis->x = 0.0f;
+					pOutputControllerState->rAxis->y = 0.0f;
+				}
+
+				auto local_trigger = pControllerState->rAxis[1].x;
+
+				bool need_to_write_state = !(fake_event_queue[0].Empty() &&
+					fake_event_queue[1].Empty() && !fake_button_states[0].HasOverrides() &&
+					!fake_button_states[1].HasOverrides());
+
+				// momentary button spoofing
+				ModInputEvent event;
+				while (fake_event_queue[isLeft].Pop(event))
+				{
+					uint64_t* state = event.touch_or_press == ActionType::kPress ?
+						&(pOutputControllerState->ulButtonPressed) :
+						&(pOutputControllerState->ulButtonTouched);
+
+					*state = event.button_state == ButtonState::kButtonDown ?
+						*state | 1ull << event.button_ID :
+						*state & ~(1ull << event.button_ID);
+
+					if (event.button_ID == k_EButton_SteamVR_Trigger)
+					{
+						if (event.button_state == ButtonState::kButtonDown &&
+							event.touch_or_press == ActionType::kPress)
+						{
+							local_trigger = 1.f;
+						}
+						else { local_trigger = 0.f; }
+					}
+				}
+
+				// hold button spoofing
+				{
+					auto& masks = fake_button_states[isLeft];
+
+					pOutputControllerState->ulButtonPressed =
+						(pOutputControllerState->ulButtonPressed |
+							masks.pressed_set.load(std::memory_order_acquire)) &
+						~masks.pressed_clear.load(std::memory_order_acquire);
+					pOutputControllerState->ulButtonTouched =
+						(pOutputControllerState->ulButtonTouched |
+							masks.touched_set.load(std::memory_order_acquire)) &
+						~masks.touched_clear.load(std::memory_order_acquire);
+
+					if (float fake_trigger = masks.trigger.load(std::memory_order_acquire);
+						fake_trigger >= 0.f)
+					{
+						local_trigger = fake_trigger;
+					}
+				}
+
+				if (block_all_inputs)
+				{
+					pOutputControllerState->ulButtonPressed = 0;
+					pOutputControllerState->ulButtonTouched = 0;
+					pOutputControllerState->rAxis[0].x = 0.0;
+					pOutputControllerState->rAxis[0].y = 0.0;
+					local_trigger = 0.0;
+				}
+
+				if (need_to_write_state && g_set_controller_axes && g_set_controller_buttons)
+				{
+					g_set_controller_axes(pOutputControllerState->rAxis[0].x,
+						pOutputControllerState->rAxis[0].y, local_trigger);
+
+					g_set_controller_buttons();
+				}
+			}
+		}
+		return true;
+	}
+
+	inline float SmoothingFactor(float a_cutoff, float a_dt)
+	{
+		float tau = 1.f / (2 * std::numbers::pi_v<float> * a_cutoff);
+		return 1.f / (1.f + tau / a_dt);
+	}
+
+	void SmoothPose(PoseFilter& a_filter, vr::TrackedDevicePose_t& a_pose,
+		std::chrono::steady_clock::time_point a_now)
+	{
+		auto& m = a_pose.mDeviceToAbsoluteTracking.m;
+
+		RE::NiPoint3  position(m[0][3], m[1][3], m[2][3]);
+		RE::NiMatrix3 rotate;
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++) { rotate.entry[i][j] = m[i][j]; }
+		}
+
+		float dt = std::chrono::duration<float>(a_now - a_filter.time).count();
+		if (!a_pose.bPoseIsValid)
+		{
+			a_filter.valid = false;
+			return;
+		}
+		if (!a_filter.valid || dt <= 0.f || dt > kSmoothMaxGap)
+		{
+			a_filter = { position, helper::Mat2Quat(rotate), a_now, true };
+			return;
+		}
+		a_filter.time = a_now;
+
+		auto& v = a_pose.vVelocity.v;
+		auto& w = a_pose.vAngularVelocity.v;
+		float speed = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+		float angular_speed = std::sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+
+		a_filter.position += (position - a_filter.position) *
+			SmoothingFactor(kSmoothMinCutoff + kSmoothBeta * speed, dt);
+		a_filter.rotation = helper::QuatSlerp(a_filter.rotation, helper::Mat2Quat(rotate),
+			SmoothingFactor(kSmoothMinCutoff + kSmoothAngularBeta * angular_speed, dt));
+
+		helper::Quat2Mat(rotate, a_filter.rotation);
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++) { m[i][j] = rotate.entry[i][j]; }
+			m[i][3] = a_filter.position[i];
+		}
+	}
+
+	bool                         overlapping = false;
+	PapyrusVR::TrackedDevicePose bow;
+	PapyrusVR::TrackedDevicePose arrow;
+
+	// handles device poses and queues haptic events
+	vr::EVRCompositorError ControllerPoseCallback(VR_ARRAY_COUNT(unRenderPoseArrayCount)
+													  vr::TrackedDevicePose_t* pRenderPoseArray,
+		uint32_t                                                      unRenderPoseArrayCount,
+		VR_ARRAY_COUNT(unGamePoseArrayCount) vr::TrackedDevicePose_t* pGamePoseArray,
+		uint32_t                                                      unGamePoseArrayCount)
+	{
+		using namespace PapyrusVR;
+
+		PROFILE_SCOPE(kPoseCallback);
+
+		if (pGamePoseArray)
+		{
+			auto now = std::chrono::steady_clock::now();
+			bool smooth = smoothing.load(std::memory_order_relaxed);
+
+			for (auto hand : { Hand::kRight, Hand::kLeft })
+			{
+				auto device = hand == Hand::kLeft ? g_leftcontroller : g_rightcontroller;
+				if (device >= unGamePoseArrayCount) { continue; }
+
+				if (smooth) { SmoothPose(pose_filters[(int)hand], pGamePoseArray[device], now); }
+				else { pose_filters[(int)hand].valid = false; }
+
+				controller_poses[(int)hand] = pGamePoseArray[device];
+			}
+		}
+
+		arrownock::OnUpdate();
+
+		AdvanceHoldTimers();
+
+		// only queue the pulses, the driver call happens on the dispatcher thread
+		auto now = haptics::Clock::now();
+		auto dispatcher = haptics::PulseDispatcher::GetSingleton();
+
+		dispatcher->Request(true, g_leftcontroller, haptics::Mix(true, now));
+		dispatcher->Request(false, g_rightcontroller, haptics::Mix(false, now));
+
+		return vr::EVRCompositorError::VRCompositorError_None;
+	}
+
+	const vr::TrackedDevicePose_t& GetGamePose(Hand a_hand)
+	{
+		return controller_poses[a_hand == Hand::kLeft];
+	}
+
+	RE::NiPoint3 TrackingToRoomVector(const vr::HmdVector3_t& a_vector, float a_units_per_meter)
+	{
+		// OpenVR is right handed y up, Skyrim is z up with y forward
+		return RE::NiPoint3(a_vector.v[0], -a_vector.v[2], a_vector.v[1]) * a_units_per_meter;
+	}
+
+	RE::NiPoint3 TrackingToWorldVector(const vr::HmdVector3_t& a_vector, float a_units_per_meter)
+	{
+		auto room = TrackingToRoomVector(a_vector, a_units_per_meter);
+
+		if (auto pcvr = RE::PlayerCharacter::GetSingleton()->GetVRNodeData();
+			pcvr && pcvr->RoomNode)
+		{
+			return pcvr->RoomNode->world.rotate * room * pcvr->RoomNode->world.scale;
+		}
+		return room;
+	}
+
+	RE::NiTransform GamePoseToRoomTransform(
+		const vr::TrackedDevicePose_t& a_pose, float a_units_per_meter)
+	{
+		// same axis swap as TrackingToRoomVector, applied to both sides of the rotation
+		constexpr int   kAxis[3] = { 0, 2, 1 };
+		constexpr float kSign[3] = { 1.f, -1.f, 1.f };
+
+		auto&           m = a_pose.mDeviceToAbsoluteTracking.m;
+		RE::NiTransform result;
+
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				result.rotate.entry[i][j] = kSign[i] * kSign[j] * m[kAxis[i]][kAxis[j]];
+			}
+			result.translate[i] = kSign[i] * m[kAxis[i]][3] * a_units_per_meter;
+		}
+		return result;
+	}
+
+	void Vibrate(bool isLeft, const haptics::Pattern& a_pattern, float a_power, int a_priority)
+	{
+		haptics::Play(isLeft, a_pattern, std::clamp(a_power, 0.1f, 1.0f), a_priority);
+	}
+
+	RE::NiTransform HmdMatrixToNiTransform(const HmdMatrix34_t& hmdMatrix)
+	{
+		RE::NiTransform niTransform;
+
+		// Copy rotation matrix
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j) { niTransform.rotate.entry[i][j] = hmdMatrix.m[i][j]; }
+		}
+
+		// Copy translation vector
+		niTransform.translate.x = hmdMatrix.m[0][3];
+		niTransform.translate.y = hmdMatrix.m[1][3];
+		niTransform.translate.z = hmdMatrix.m[2][3];
+
+		return niTransform;
+	}
+
+	HmdMatrix34_t NiTransformToHmdMatrix(const RE::NiTransform& niTransform)
+	{
+		HmdMatrix34_t hmdMatrix;
+
+		// Copy rotation matrix
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j) { hmdMatrix.m[i][j] = niTransform.rotate.entry[i][j]; }
+		}
+
+		// Copy translation vector
+		hmdMatrix.m[0][3] = niTransform.translate.x;
+		hmdMatrix.m[1][3] = niTransform.translate.y;
+		hmdMatrix.m[2][3] = niTransform.translate.z;
+
+		return hmdMatrix;
+	}
+}
@@ -0,0 +1,24 @@
+#include "test_util.h"
+
+#include <cstdlib>
+#include <new>
+
+/* Replaces the global allocation functions to count every heap allocation of the program */
+namespace test
+{
+	std::atomic<uint64_t> g_allocations = 0;
+}
+
+void* operator new(std::size_t a_size)
+{
+	test::g_allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* ptr = std::malloc(a_size ? a_size : 1)) { return ptr; }
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t a_size) { return operator new(a_size); }
+
+void operator delete(void* a_ptr) noexcept { std::free(a_ptr); }
+void operator delete[](void* a_ptr) noexcept { std::free(a_ptr); }
+void operator delete(void* a_ptr, std::size_t) noexcept { std::free(a_ptr); }
+void operator delete[](void* a_ptr, std::size_t) noexcept { std::free(a_ptr); }
@@ -0,0 +1,192 @@
+#include "mod_event_sink.hpp"
+#include "test_util.h"
+
+/* Event storms through EventSink the way the game sends them, a BSTEventSource calling the sink for
+* every equip in a crowded cell, from one or several threads and with subscriptions being added and
+* removed meanwhile. The mutex sink it replaced is kept as the reference.
+*/
+namespace
+{
+	using Event = RE::TESEquipEvent;
+
+	// the sink as it was before the snapshot: one lock around every dispatch
+	class LegacySink : public RE::BSTEventSink<Event>
+	{
+	public:
+		void AddCallback(EventCallback<Event> a_callback)
+		{
+			std::scoped_lock lock(callback_lock);
+			callbacks.push_back(a_callback);
+		}
+
+		void RemoveCallback(EventCallback<Event> a_callback)
+		{
+			std::scoped_lock lock(callback_lock);
+			auto             it = std::find(callbacks.begin(), callbacks.end(), a_callback);
+			if (it != callbacks.end()) { callbacks.erase(it); }
+		}
+
+		RE::BSEventNotifyControl ProcessEvent(const Event* a_event, RE::BSTEventSource<Event>*)
+		{
+			std::scoped_lock lock(callback_lock);
+			for (auto callback : callbacks) callback(a_event);
+			return RE::BSEventNotifyControl::kContinue;
+		}
+
+	private:
+		std::mutex                        callback_lock;
+		std::vector<EventCallback<Event>> callbacks;
+	};
+
+	constexpr int kMaxSubscribers = 16;
+	constexpr int kEvents = 256;  // one in kPlayerEvery of them is the player's
+	constexpr int kPlayerEvery = 64;
+
+	thread_local uint64_t t_calls = 0;
+
+	std::array<RE::Actor, 8>   g_npcs;
+	std::array<Event, kEvents> g_events;
+
+	template <size_t I>
+	void Subscriber(const Event* a_event)
+	{
+		t_calls += I + 1;
+		test::DoNotOptimize(a_event->baseObject);
+	}
+
+	template <size_t... I>
+	constexpr auto MakeSubscribers(std::index_sequence<I...>)
+	{
+		return std::array<EventCallback<Event>, sizeof...(I)>{ &Subscriber<I>... };
+	}
+	constexpr auto kSubscribers = MakeSubscribers(std::make_index_sequence<kMaxSubscribers>());
+
+	bool IsPlayer(const Event* a_event)
+	{
+		return a_event->actor.get() == RE::PlayerCharacter::GetSingleton();
+	}
+
+	void Churn(const Event*) {}
+
+	template <typename Sink>
+	void Subscribe(Sink* a_sink, int a_count, bool a_add)
+	{
+		for (int i = 0; i < a_count; i++)
+		{
+			if (a_add) { a_sink->AddCallback(kSubscribers[i]); }
+			else { a_sink->RemoveCallback(kSubscribers[i]); }
+		}
+	}
+
+	/* returns: ns per event on each of a_threads threads sending a_events each, while another
+	* thread adds and removes a subscription as fast as it can if a_churn
+	*/
+	template <typename Sink>
+	double Storm(Sink* a_sink, int a_threads, uint64_t a_events, bool a_churn)
+	{
+		RE::BSTEventSource<Event> source;
+		source.AddEventSink(a_sink);
+
+		std::atomic<bool> done = false;
+		std::jthread      churn;
+		if (a_churn)
+		{
+			churn = std::jthread([&] {
+				while (!done.load(std::memory_order_relaxed))
+				{
+					a_sink->AddCallback(Churn);
+					a_sink->RemoveCallback(Churn);
+				}
+			});
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		{
+			std::vector<std::jthread> senders;
+			for (int t = 0; t < a_threads; t++)
+			{
+				senders.emplace_back([&, t] {
+					for (uint64_t i = 0; i < a_events; i++)
+					{
+						source.SendEvent(&g_events[(i + t * 17) % kEvents]);
+					}
+				});
+			}
+		}
+		std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		done = true;
+		return elapsed.count() / a_events;
+	}
+
+	void Compare(int a_subscribers, int a_threads, bool a_churn, uint64_t a_events)
+	{
+		auto       sink = EventSink<Event>::GetSingleton();
+		LegacySink legacy;
+
+		Subscribe(sink, a_subscribers, true);
+		Subscribe(&legacy, a_subscribers, true);
+		double snapshot_ns = Storm(sink, a_threads, a_events, a_churn);
+		double legacy_ns = Storm(&legacy, a_threads, a_events, a_churn);
+		Subscribe(sink, a_subscribers, false);
+
+		std::printf("  %2d subscribers %d sender(s)%-9s %8.1f ns/event %8.1f with the mutex\n",
+			a_subscribers, a_threads, a_churn ? ", churn" : "", snapshot_ns, legacy_ns);
+	}
+
+	// a callback that edits the subscriptions, which deadlocked under the mutex
+	void RemoveSelf(const Event*)
+	{
+		t_calls++;
+		EventSink<Event>::GetSingleton()->RemoveCallback(RemoveSelf);
+		EventSink<Event>::GetSingleton()->AddCallback(Subscriber<0>);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	uint64_t events = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+
+	for (int i = 0; i < kEvents; i++)
+	{
+		g_events[i].actor.ptr = i % kPlayerEvery ? &g_npcs[i % g_npcs.size()] :
+		                                           RE::PlayerCharacter::GetSingleton();
+		g_events[i].baseObject = 0x1000 + i;
+		g_events[i].equipped = i % 2;
+	}
+
+	auto                      sink = EventSink<Event>::GetSingleton();
+	RE::BSTEventSource<Event> source;
+	source.AddEventSink(sink);
+
+	// subscriptions changed from inside a callback apply from the next event on
+	sink->AddCallback(RemoveSelf);
+	t_calls = 0;
+	source.SendEvent(&g_events[1]);
+	CHECK(t_calls == 1);
+	source.SendEvent(&g_events[1]);
+	CHECK(t_calls == 2);
+	sink->RemoveCallback(Subscriber<0>);
+
+	// dispatch never allocates, filtered or not
+	sink->AddCallback(Subscriber<0>);
+	sink->AddCallback(Subscriber<1>, IsPlayer);
+	uint64_t delivered = sink->Delivered();
+	uint64_t filtered = sink->Filtered();
+	uint64_t allocations = test::g_allocations.load();
+	double   filtered_ns = test::NsPerCall(kEvents * 64,
+		[&](uint64_t i) { source.SendEvent(&g_events[i % kEvents]); });
+	CHECK(test::g_allocations.load() == allocations);
+	CHECK(sink->Delivered() - delivered == kEvents * 64 + 64 * kEvents / kPlayerEvery);
+	CHECK(sink->Filtered() - filtered == 64 * (kEvents - kEvents / kPlayerEvery));
+	sink->RemoveCallback(Subscriber<0>);
+	sink->RemoveCallback(Subscriber<1>);
+
+	std::printf("%llu events per sender:\n", (unsigned long long)events);
+	std::printf("  1 subscriber + 1 player only   %8.1f ns/event\n", filtered_ns);
+	for (int subscribers : { 1, 4, 16 }) { Compare(subscribers, 1, false, events); }
+	Compare(4, 4, false, events);
+	Compare(4, 4, true, events);
+	Compare(2, 1, true, events);
+
+	return test::Failures();
+}
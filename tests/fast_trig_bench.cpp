@@ -0,0 +1,148 @@
+#include "fast_trig.h"
+#include "test_util.h"
+
+#include <bit>
+#include <random>
+
+/* Accuracy report and throughput of the polynomial trig in fast_trig.h against the standard
+* library. The sweep takes every a_stride-th float of each domain, all of them with a stride of 1,
+* and measures the absolute error against the double precision function. The bounds checked are
+* the ones fast_trig.h documents; the standard library in float is swept as well for comparison.
+*/
+namespace
+{
+	constexpr float kPi = std::numbers::pi_v<float>;
+
+	struct Sweep
+	{
+		double max_error = 0;
+		float  at = 0;
+		size_t count = 0;
+	};
+
+	/* a_func against a_reference at every a_stride-th float in [a_min, a_max], both signs from 0
+	* outward so the stride lands on the same magnitudes either side
+	*/
+	template <typename F, typename R>
+	Sweep SweepDomain(float a_min, float a_max, uint32_t a_stride, F&& a_func, R&& a_reference)
+	{
+		Sweep result;
+		auto  visit = [&](float x) {
+			double error = std::abs(a_func(x) - a_reference((double)x));
+			if (!(error <= result.max_error))
+			{
+				result.max_error = std::isnan(error) ? INFINITY : error;
+				result.at = x;
+			}
+			result.count++;
+		};
+
+		for (float sign : { 1.f, -1.f })
+		{
+			float    limit = sign > 0 ? a_max : -a_min;
+			uint32_t last = std::bit_cast<uint32_t>(limit);
+			if (limit < 0) { continue; }
+			for (uint64_t bits = 0; bits <= last; bits += a_stride)
+			{
+				visit(sign * std::bit_cast<float>((uint32_t)bits));
+			}
+			visit(sign * limit);
+		}
+		return result;
+	}
+
+	struct Row
+	{
+		const char* name;
+		float       min, max;
+		double      bound;  // documented in fast_trig.h, 0 where there is none
+		float (*func)(float);
+		double (*reference)(double);
+	};
+
+	float StdSin(float x) { return std::sin(x); }
+	float StdCos(float x) { return std::cos(x); }
+	float StdAcos(float x) { return std::acos(x); }
+	double RefSin(double x) { return std::sin(x); }
+	double RefCos(double x) { return std::cos(x); }
+	double RefAcos(double x) { return std::acos(x); }
+
+	const Row kRows[] = {
+		{ "FastAcos", -1, 1, 7e-5, helper::FastAcos, RefAcos },
+		{ "std::acos", -1, 1, 0, StdAcos, RefAcos },
+		{ "FastSin", -8 * kPi, 8 * kPi, 4e-6, helper::FastSin, RefSin },
+		{ "std::sin", -8 * kPi, 8 * kPi, 0, StdSin, RefSin },
+		{ "FastCos", -8 * kPi, 8 * kPi, 4e-6, helper::FastCos, RefCos },
+		{ "std::cos", -8 * kPi, 8 * kPi, 0, StdCos, RefCos },
+	};
+
+	void ReportAccuracy(uint32_t a_stride)
+	{
+		std::printf("%-10s %-18s %12s %12s %12s %12s\n", "function", "domain", "points",
+			"max error", "at", "bound");
+		for (auto& row : kRows)
+		{
+			auto sweep = SweepDomain(row.min, row.max, a_stride, row.func, row.reference);
+			char domain[32];
+			std::snprintf(domain, sizeof(domain), "[%.4g, %.4g]", row.min, row.max);
+			std::printf("%-10s %-18s %12zu %12.3g %12.6g %12.3g\n", row.name, domain, sweep.count,
+				sweep.max_error, sweep.at, row.bound);
+			if (row.bound > 0) { CHECK(sweep.max_error <= row.bound); }
+		}
+	}
+
+	/* Independent calls over inputs spread across the domain, the way per frame code calls them.
+	* Through lambdas, so the inline fast versions are inlined as they are in the plugin
+	*/
+	template <typename F>
+	double NsPerEval(uint64_t a_passes, const std::vector<float>& a_inputs, F&& a_func)
+	{
+		float  sum = 0;
+		double ns = test::NsPerCall(a_passes, [&](uint64_t) {
+			for (float x : a_inputs) { sum += a_func(x); }
+			test::DoNotOptimize(sum);
+		});
+		return ns / a_inputs.size();
+	}
+
+	template <typename F, typename S>
+	void CompareThroughput(const char* a_name, uint64_t a_passes,
+		const std::vector<float>& a_inputs, F&& a_fast, S&& a_std)
+	{
+		double fast = NsPerEval(a_passes, a_inputs, a_fast);
+		double standard = NsPerEval(a_passes, a_inputs, a_std);
+		std::printf("%-10s %12.2f %12.2f %7.1fx\n", a_name, fast, standard, standard / fast);
+	}
+
+	void ReportThroughput(uint64_t a_passes)
+	{
+		std::mt19937                          engine{ 0x5eed };
+		std::uniform_real_distribution<float> unit(-1, 1), angle(-2 * kPi, 2 * kPi);
+		std::vector<float>                    unit_inputs(4096), angle_inputs(4096);
+		for (auto& x : unit_inputs) { x = unit(engine); }
+		for (auto& x : angle_inputs) { x = angle(engine); }
+
+		std::printf("\n%-10s %12s %12s %8s\n", "ns/call", "fast", "std", "speedup");
+		CompareThroughput(
+			"acos", a_passes, unit_inputs, [](float x) { return helper::FastAcos(x); },
+			[](float x) { return std::acos(x); });
+		CompareThroughput(
+			"sin", a_passes, angle_inputs, [](float x) { return helper::FastSin(x); },
+			[](float x) { return std::sin(x); });
+		CompareThroughput(
+			"cos", a_passes, angle_inputs, [](float x) { return helper::FastCos(x); },
+			[](float x) { return std::cos(x); });
+	}
+}
+
+int main(int argc, char** argv)
+{
+	// every float by default, which takes several minutes
+	uint32_t stride = argc > 1 ? (uint32_t)std::strtoul(argv[1], nullptr, 10) : 1;
+	uint64_t passes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2000;
+
+	ReportAccuracy(std::max(stride, 1u));
+	ReportThroughput(passes);
+
+	return test::Failures();
+}
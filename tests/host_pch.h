@@ -0,0 +1,58 @@
+#pragma once
+
+/* Host counterpart of PCH.h, force included into every host target. CommonLibSSE brings in most of
+* the standard library through RE/Skyrim.h, so the sources rely on that.
+*/
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "RE/Skyrim.h"
+#include "SKSE/SKSE.h"
+
+#include <REL/Relocation.h>
+
+#if __has_include(<format>)
+#	include <format>
+#else
+// libstdc++ before 13 has no <format>, fmt implements the same syntax
+#	include <fmt/chrono.h>
+namespace std
+{
+	using fmt::format;
+}
+#endif
+
+// MSVC names the plugin sources use
+inline float _copysign(float a_magnitude, float a_sign)
+{
+	return std::copysign(a_magnitude, a_sign);
+}
+
+namespace std
+{
+	using ::cosf;
+	using ::powf;
+	using ::sinf;
+}
+
+using namespace std::literals;
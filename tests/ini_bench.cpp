@@ -0,0 +1,188 @@
+#include "main_plugin.h"
+#include "test_util.h"
+
+#include <fstream>
+
+/* Loads SeamlessArrowNocking.ini through kIniSchema the way ReadConfig does and compares it with
+* the per-key readers it replaced, which rescanned the file from the start for every key.
+*/
+namespace
+{
+	using arrownock::IniSettings;
+
+	// the readers as they were before the schema, one full scan of the stream per key
+	bool LegacyFind(std::ifstream& a_file, const std::string& a_setting, std::string& a_value)
+	{
+		std::string line;
+		while (std::getline(a_file, line))
+		{
+			if (!line.empty() && line[0] != '#' && line.find(a_setting) == 0)
+			{
+				auto found = line.find('=');
+				if (found != std::string::npos)
+				{
+					a_file.clear();
+					a_file.seekg(0, std::ios::beg);
+					a_value = line.substr(found + 1);
+					return true;
+				}
+			}
+		}
+		a_file.clear();
+		a_file.seekg(0, std::ios::beg);
+		return false;
+	}
+
+	int LegacyReadInt(std::ifstream& a_file, const std::string& a_setting)
+	{
+		std::string value;
+		return LegacyFind(a_file, a_setting, value) ? std::stoi(value) : 0;
+	}
+
+	float LegacyReadFloat(std::ifstream& a_file, const std::string& a_setting)
+	{
+		std::string value;
+		return LegacyFind(a_file, a_setting, value) ? std::stof(value) : 0.f;
+	}
+
+	std::string LegacyReadString(std::ifstream& a_file, const std::string& a_setting)
+	{
+		std::string value;
+		if (!LegacyFind(a_file, a_setting, value)) { return ""; }
+		value.erase(0, value.find_first_not_of(" \t\n\r"));
+		value.erase(value.find_last_not_of(" \t\n\r") + 1);
+		return value;
+	}
+
+	IniSettings LegacyLoad(const std::filesystem::path& a_path)
+	{
+		std::ifstream config(a_path);
+		IniSettings   ini;
+		ini.enable_nocking = LegacyReadInt(config, "iEnableAutonocking");
+		ini.firebutton = LegacyReadInt(config, "FireButtonID");
+		ini.debug_level = LegacyReadInt(config, "Debug");
+		ini.grace_period_ms = LegacyReadInt(config, "iGracePeriod");
+		ini.stamina_threshold = LegacyReadFloat(config, "fStaminaThreshold");
+		ini.stamina_autorecover = LegacyReadInt(config, "iAutonockAfterBlocking");
+		ini.stamina_haptic_strength = LegacyReadFloat(config, "fHapticStrength");
+		ini.stamina_visual_idx = LegacyReadInt(config, "iVisualEffect");
+		ini.stamina_sound_editorID = LegacyReadString(config, "sBlockedSound");
+		ini.prediction_horizon_ms = LegacyReadFloat(config, "fPredictionHorizonMs");
+		ini.raw_pose_overlap = LegacyReadInt(config, "iRawPoseOverlap");
+		ini.profiler_interval_s = LegacyReadInt(config, "iProfilerInterval");
+		ini.nock_angle_threshold = LegacyReadFloat(config, "fNockAngleThreshold");
+		ini.frames_between_attempts = LegacyReadInt(config, "iFramesBetweenAttempts");
+		return ini;
+	}
+
+	IniSettings SchemaLoad(const std::filesystem::path& a_path)
+	{
+		IniSettings ini;
+		if (auto text = helper::ReadWholeFile(a_path))
+		{
+			helper::ApplyIni(*text, arrownock::kIniIndex, ini);
+		}
+		return ini;
+	}
+
+	constexpr std::pair<std::string_view, std::string_view> kValues[] = {
+		{ "iEnableAutonocking", "1" }, { "FireButtonID", "33" }, { "Debug", "0" },
+		{ "iGracePeriod", "350" }, { "fStaminaThreshold", "0.25" },
+		{ "iAutonockAfterBlocking", "0" }, { "fHapticStrength", "0.6" },
+		{ "iVisualEffect", "1" }, { "sBlockedSound", "UIMenuCancel" },
+		{ "fPredictionHorizonMs", "20" }, { "iRawPoseOverlap", "1" },
+		{ "iProfilerInterval", "0" }, { "fNockAngleThreshold", "0.008" },
+		{ "iFramesBetweenAttempts", "3" }
+	};
+
+	/* An ini laid out like the shipped one: a section header and a comment block above every key.
+	* a_comment_lines: lines of comments per key
+	*/
+	std::string MakeIni(int a_comment_lines)
+	{
+		std::string text = "[Settings]\r\n";
+		for (auto& [key, value] : kValues)
+		{
+			for (int i = 0; i < a_comment_lines; i++)
+			{
+				text += "# ";
+				text += key;
+				text += " explained in a sentence that is about as long as the real ones\r\n";
+			}
+			text += std::string(key) + " = " + std::string(value) + "\r\n\r\n";
+		}
+		return text;
+	}
+
+	void CheckLoaded(const IniSettings& a_ini)
+	{
+		CHECK(a_ini.enable_nocking);
+		CHECK(a_ini.firebutton == 33);
+		CHECK(a_ini.grace_period_ms == 350);
+		CHECK(a_ini.stamina_threshold == 0.25f);
+		CHECK(!a_ini.stamina_autorecover);
+		CHECK(a_ini.stamina_haptic_strength == 0.6f);
+		CHECK(a_ini.stamina_visual_idx == 1);
+		CHECK(a_ini.stamina_sound_editorID == "UIMenuCancel");
+		CHECK(a_ini.prediction_horizon_ms == 20.f);
+		CHECK(a_ini.raw_pose_overlap);
+		CHECK(a_ini.nock_angle_threshold == 0.008f);
+		CHECK(a_ini.frames_between_attempts == 3);
+	}
+
+	template <typename F>
+	void Measure(const char* a_name, uint64_t a_iterations, F&& a_load)
+	{
+		auto   allocations = test::g_allocations.load();
+		double ns = test::NsPerCall(a_iterations, [&](uint64_t) {
+			auto ini = a_load();
+			test::DoNotOptimize(ini.firebutton);
+		});
+		std::printf("  %-22s %10.0f ns/load %8.1f allocs/load\n", a_name, ns,
+			double(test::g_allocations.load() - allocations) / a_iterations);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	uint64_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000;
+	auto     path = std::filesystem::temp_directory_path() / "SeamlessArrowNocking_bench.ini";
+
+	for (int comment_lines : { 0, 3, 20 })
+	{
+		auto text = MakeIni(comment_lines);
+		std::ofstream(path, std::ios::binary) << text;
+
+		CheckLoaded(SchemaLoad(path));
+		CheckLoaded(LegacyLoad(path));
+
+		std::printf("%d comment lines per key, %zu bytes:\n", comment_lines, text.size());
+		Measure("per key rescan", iterations, [&] { return LegacyLoad(path); });
+		Measure("schema, file", iterations, [&] { return SchemaLoad(path); });
+		Measure("schema, parse only", iterations, [&] {
+			IniSettings ini;
+			helper::ApplyIni(text, arrownock::kIniIndex, ini);
+			return ini;
+		});
+	}
+
+	// keys missing from the file keep their defaults instead of becoming 0
+	IniSettings ini;
+	CHECK(helper::ApplyIni("Debug = 1\r\niGracePeriod = abc\r\nDebugX = 2\r\n",
+		arrownock::kIniIndex, ini) == 1);
+	CHECK(ini.debug_level == 1);
+	CHECK(ini.grace_period_ms == IniSettings().grace_period_ms);
+	CHECK(ini.enable_nocking);
+	CHECK(ini.frames_between_attempts == IniSettings().frames_between_attempts);
+
+	// the index finds every key of the schema and nothing else
+	for (auto& field : arrownock::kIniSchema)
+	{
+		CHECK(arrownock::kIniIndex.Find(field.key) == &field);
+	}
+	CHECK(!arrownock::kIniIndex.Find("Debu"));
+	CHECK(!arrownock::kIniIndex.Find("iVisualEffects"));
+
+	std::filesystem::remove(path);
+	return test::Failures();
+}
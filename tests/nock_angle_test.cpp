@@ -0,0 +1,253 @@
+#include "helper_math.h"
+#include "main_plugin.h"
+#include "test_util.h"
+
+#include <random>
+
+/* IsArrowNocked against the check it replaced, which took the norm of the difference of two Euler
+* decompositions. Bow and hand world rotations are built in double, rounded to float like the scene
+* graph's, and the bow to hand rotation is taken in float the way GetBowHandRotation does.
+*/
+namespace
+{
+	using RE::NiMatrix3;
+	using RE::NiPoint3;
+	using RE::NiQuaternion;
+
+	struct Rotation
+	{
+		double m[3][3];
+
+		Rotation operator*(const Rotation& a_rhs) const
+		{
+			Rotation result;
+			for (int i = 0; i < 3; i++)
+			{
+				for (int j = 0; j < 3; j++)
+				{
+					result.m[i][j] = m[i][0] * a_rhs.m[0][j] + m[i][1] * a_rhs.m[1][j] +
+						m[i][2] * a_rhs.m[2][j];
+				}
+			}
+			return result;
+		}
+
+		NiMatrix3 ToFloat() const
+		{
+			NiMatrix3 result;
+			for (int i = 0; i < 3; i++)
+			{
+				for (int j = 0; j < 3; j++) { result.entry[i][j] = (float)m[i][j]; }
+			}
+			return result;
+		}
+	};
+
+	// unit axis, Rodrigues' formula
+	Rotation AxisAngle(const double a_axis[3], double a_angle)
+	{
+		double   c = std::cos(a_angle), s = std::sin(a_angle), t = 1 - c;
+		double   x = a_axis[0], y = a_axis[1], z = a_axis[2];
+		Rotation r = { { { t * x * x + c, t * x * y - s * z, t * x * z + s * y },
+			{ t * x * y + s * z, t * y * y + c, t * y * z - s * x },
+			{ t * x * z - s * y, t * y * z + s * x, t * z * z + c } } };
+		return r;
+	}
+
+	// Euler XYZ as the rotation X(a_x) * Y(a_y) * Z(a_z), the convention ToEulerAnglesXYZ reads
+	Rotation EulerXYZ(double a_x, double a_y, double a_z)
+	{
+		const double x[3] = { 1, 0, 0 }, y[3] = { 0, 1, 0 }, z[3] = { 0, 0, 1 };
+		return AxisAngle(x, a_x) * AxisAngle(y, a_y) * AxisAngle(z, a_z);
+	}
+
+	struct Random
+	{
+		std::mt19937_64 engine{ 0x5eed };
+
+		double Uniform(double a_min, double a_max)
+		{
+			return std::uniform_real_distribution<double>(a_min, a_max)(engine);
+		}
+
+		void Axis(double a_out[3])
+		{
+			std::normal_distribution<double> normal;
+			double                           length = 0;
+			for (int i = 0; i < 3; i++)
+			{
+				a_out[i] = normal(engine);
+				length += a_out[i] * a_out[i];
+			}
+			for (int i = 0; i < 3; i++) { a_out[i] /= std::sqrt(length); }
+		}
+
+		Rotation Any()
+		{
+			double axis[3];
+			Axis(axis);
+			// uniform over rotations: angle density proportional to 1 - cos
+			double angle;
+			do {
+				angle = Uniform(0, std::numbers::pi);
+			} while (Uniform(0, 2) > 1 - std::cos(angle));
+			return AxisAngle(axis, angle);
+		}
+	};
+
+	// NiMatrix3::ToEulerAnglesXYZ as CommonLib implements it
+	NiPoint3 LegacyEulerXYZ(const NiMatrix3& a_matrix)
+	{
+		auto&    m = a_matrix.entry;
+		NiPoint3 angle;
+		angle.y = std::asin(std::clamp(m[0][2], -1.f, 1.f));
+		if (angle.y < std::numbers::pi_v<float> / 2)
+		{
+			if (angle.y > -std::numbers::pi_v<float> / 2)
+			{
+				angle.x = -std::atan2(-m[1][2], m[2][2]);
+				angle.z = -std::atan2(-m[0][1], m[0][0]);
+			}
+			else
+			{
+				angle.x = -std::atan2(m[1][0], m[1][1]);
+				angle.z = 0;
+			}
+		}
+		else
+		{
+			angle.x = std::atan2(m[1][0], m[1][1]);
+			angle.z = 0;
+		}
+		return angle;
+	}
+
+	bool LegacyNocked(const NiMatrix3& a_base, const NiMatrix3& a_current, float a_threshold)
+	{
+		return (LegacyEulerXYZ(a_base) - LegacyEulerXYZ(a_current)).Length() > a_threshold;
+	}
+
+	// IsArrowNocked
+	bool Nocked(const NiMatrix3& a_base, const NiMatrix3& a_current, float a_sin_sq)
+	{
+		return helper::QuatHalfAngleSinSq(helper::Mat2Quat(a_base), helper::Mat2Quat(a_current)) >
+			a_sin_sq;
+	}
+
+	struct Sample
+	{
+		NiMatrix3 base;     // bow to hand when the bow was equipped
+		NiMatrix3 current;  // a later frame, the hand a_angle further around a random axis
+	};
+
+	/* a_grip: the bow to hand rotation of the sample, the bow is anywhere in the world */
+	Sample MakeSample(Random& a_random, const Rotation& a_grip, double a_angle)
+	{
+		double axis[3];
+		a_random.Axis(axis);
+
+		auto bow = a_random.Any();
+		auto hand = bow * a_grip;
+		auto bow_later = a_random.Any();
+		auto hand_later = bow_later * a_grip * AxisAngle(axis, a_angle);
+
+		return { bow.ToFloat().Transpose() * hand.ToFloat(),
+			bow_later.ToFloat().Transpose() * hand_later.ToFloat() };
+	}
+
+	struct Scenario
+	{
+		const char* name;
+		Rotation (*grip)(Random&);
+	};
+
+	constexpr Scenario kScenarios[] = {
+		{ "any grip", [](Random& r) { return r.Any(); } },
+		{ "axis aligned grip",
+			[](Random& r) {
+				int turns = (int)r.Uniform(0, 4);
+				return EulerXYZ(0, turns * std::numbers::pi / 2, 0);
+			} },
+		{ "grip pitched 89.8 deg",
+			[](Random& r) { return EulerXYZ(r.Uniform(-3, 3), 1.5673, r.Uniform(-3, 3)); } },
+		{ "grip rolled 179.9 deg",
+			[](Random& r) { return EulerXYZ(3.1399, r.Uniform(-1, 1), r.Uniform(-1, 1)); } },
+	};
+
+	constexpr double kRatios[] = { 0.5, 0.9, 0.99, 1.01, 1.1, 2.0 };
+
+	void Sweep(float a_threshold, int a_samples)
+	{
+		float sin_sq = helper::HalfAngleSinSq(a_threshold);
+
+		std::printf("share nocked at %.4f rad, %d samples per angle, quaternion / Euler:\n",
+			a_threshold, a_samples);
+		std::printf("  %-24s", "angle / threshold");
+		for (double ratio : kRatios) { std::printf(" %11.2f", ratio); }
+		std::printf("\n");
+
+		for (auto& scenario : kScenarios)
+		{
+			Random random;
+			std::printf("  %-24s", scenario.name);
+			for (double ratio : kRatios)
+			{
+				int nocked = 0, legacy_nocked = 0;
+				for (int i = 0; i < a_samples; i++)
+				{
+					auto sample = MakeSample(random, scenario.grip(random), ratio * a_threshold);
+					nocked += Nocked(sample.base, sample.current, sin_sq);
+					legacy_nocked += LegacyNocked(sample.base, sample.current, a_threshold);
+				}
+				std::printf(" %5.3f/%5.3f", double(nocked) / a_samples,
+					double(legacy_nocked) / a_samples);
+
+				// decided right down to a percent of the threshold either side
+				if (ratio < 1) { CHECK(nocked == 0); }
+				else { CHECK(nocked == a_samples); }
+			}
+			std::printf("\n");
+		}
+	}
+
+	void Benchmark(uint64_t a_iterations)
+	{
+		constexpr int kFrames = 1024;
+		Random        random;
+		NiMatrix3     bow[kFrames], hand[kFrames];
+		for (int i = 0; i < kFrames; i++)
+		{
+			auto b = random.Any();
+			bow[i] = b.ToFloat();
+			hand[i] = (b * random.Any()).ToFloat();
+		}
+
+		// per frame work of IsArrowNocked once the nodes are known
+		auto   base_matrix = bow[0].Transpose() * hand[0];
+		auto   base_euler = LegacyEulerXYZ(base_matrix);
+		auto   base_rotation = helper::Mat2Quat(base_matrix);
+		float  sin_sq = helper::HalfAngleSinSq(0.005f);
+		int    nocked = 0;
+		double legacy_ns = test::NsPerCall(a_iterations, [&](uint64_t i) {
+			auto rotation = bow[i % kFrames].Transpose() * hand[i % kFrames];
+			nocked += (base_euler - LegacyEulerXYZ(rotation)).Length() > 0.005f;
+		});
+		double ns = test::NsPerCall(a_iterations, [&](uint64_t i) {
+			auto rotation = helper::Mat2Quat(bow[i % kFrames].Transpose() * hand[i % kFrames]);
+			nocked += helper::QuatHalfAngleSinSq(base_rotation, rotation) > sin_sq;
+		});
+		test::DoNotOptimize(nocked);
+		std::printf("per frame: %.1f ns quaternion, %.1f ns Euler\n", ns, legacy_ns);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int samples = argc > 1 ? std::atoi(argv[1]) : 20000;
+
+	Sweep(arrownock::IniSettings().nock_angle_threshold, samples);
+	Sweep(0.02f, samples);
+	Benchmark(samples * 100ull);
+
+	return test::Failures();
+}
@@ -0,0 +1,408 @@
+#include "main_plugin.h"
+#include "test_util.h"
+#include "vr_system_stub.h"
+
+#include <random>
+
+/* Headless nock latency benchmark. Replays synthetic draw motions through the real pose and input
+* callbacks, so arrownock::OnUpdate, IsOverlappingFromPoses, IsArrowNocked and TryNockArrow run as
+* they do in game. The player skeleton is built from the controller poses a frame late, like the
+* game's, and a stand-in for the game's own nocking reacts to the fire button the plugin presses:
+* - it nocks when the fire button goes down while the arrow hand is within fArrowDistanceToNock of
+*   the arrow snap point, and ignores a press made out of range
+* - once nocked it turns the bow in the bow hand at a fixed rate while drawing
+* Every trial is labelled from the motion that generated it: the frame the hand really came within
+* the nock radius, and whether the game was drawing when the plugin detected a nock. For each
+* tuning, refresh rate and noise level this prints the frames and ms from overlap to nocked and the
+* false nock rate.
+*/
+namespace arrownock
+{
+	extern ArrowState g_state;  // main_plugin.cpp
+}
+
+namespace
+{
+	using namespace arrownock;
+
+	constexpr vr::TrackedDeviceIndex_t kRightDevice = 1;
+	constexpr vr::TrackedDeviceIndex_t kLeftDevice = 2;
+	constexpr uint64_t                 kTrigger = 1ull << vr::k_EButton_SteamVR_Trigger;
+
+	// the motion, in meters and seconds of tracking space, which is y up
+	const RE::NiPoint3 kBowHand{ -0.2f, 1.3f, -0.4f };
+	const RE::NiPoint3 kSnapOffset{ 0.f, 0.08f, 0.f };  // arrow snap point from the bow hand
+	const RE::NiPoint3 kSnapPoint = kBowHand + kSnapOffset;
+	constexpr float    kStartDistance = 0.6f;  // arrow hand from the snap point, at the quiver
+	constexpr float    kSettleTime = 0.2f;     // both hands still before the approach
+	constexpr float    kDwellTime = 0.4f;      // at the bow, then back to the quiver if not nocked
+	constexpr float    kMinSpeed = 0.5f;       // average over the approach
+	constexpr float    kMaxSpeed = 3.f;
+
+	// how fast the game turns the bow in the bow hand while drawing, radians per second
+	constexpr float kDrawRate = 0.6f;
+
+	constexpr std::array kRefreshRates{ 72.f, 90.f, 120.f, 144.f };
+
+	/* White tracking noise on both controllers and on the bow's rotation in the bow hand */
+	struct Noise
+	{
+		const char* name;
+		float       position;  // m, standard deviation per axis
+		float       rotation;  // radians, standard deviation
+	};
+
+	constexpr std::array kNoise{ Noise{ "none", 0.f, 0.f }, Noise{ "steady", 0.001f, 0.0005f },
+		Noise{ "shaky", 0.004f, 0.002f } };
+
+	struct Tuning
+	{
+		const char* name;
+		float       radius = 18.f;  // fArrowDistanceToNock, game units
+		IniSettings ini;
+	};
+
+	std::vector<Tuning> MakeTunings()
+	{
+		std::vector<Tuning> tunings(9);
+		tunings[0].name = "default";
+		tunings[1].name = "attempt every 2";
+		tunings[1].ini.frames_between_attempts = 2;
+		tunings[2].name = "attempt every 8";
+		tunings[2].ini.frames_between_attempts = 8;
+		tunings[3].name = "angle 0.002";
+		tunings[3].ini.nock_angle_threshold = 0.002f;
+		tunings[4].name = "angle 0.01";
+		tunings[4].ini.nock_angle_threshold = 0.01f;
+		tunings[5].name = "radius 12";
+		tunings[5].radius = 12.f;
+		tunings[6].name = "radius 24";
+		tunings[6].radius = 24.f;
+		tunings[7].name = "predict 20ms";
+		tunings[7].ini.prediction_horizon_ms = 20.f;
+		tunings[8].name = "raw poses";
+		tunings[8].ini.raw_pose_overlap = true;
+		return tunings;
+	}
+
+	/* Arrow hand path: still at the quiver, minimum jerk approach to a point near the snap point,
+	* a dwell there, and the same way back
+	*/
+	struct Motion
+	{
+		RE::NiPoint3 start;
+		RE::NiPoint3 end;
+		float        approach_time;
+
+		float Duration() const { return kSettleTime + 2 * approach_time + kDwellTime; }
+
+		void At(float a_t, RE::NiPoint3& a_position, RE::NiPoint3& a_velocity) const
+		{
+			float t = a_t - kSettleTime;
+			auto  from = start;
+			auto  to = end;
+			if (t > approach_time + kDwellTime)
+			{
+				std::swap(from, to);
+				t -= approach_time + kDwellTime;
+			}
+
+			float tau = std::clamp(t / approach_time, 0.f, 1.f);
+			float s = tau * tau * tau * (10 - 15 * tau + 6 * tau * tau);
+			float ds = 30 * tau * tau * (1 - tau) * (1 - tau) / approach_time;
+			a_position = from + (to - from) * s;
+			a_velocity = (to - from) * ds;
+		}
+	};
+
+	RE::NiPoint3 RandomDirection(std::mt19937& a_rng)
+	{
+		std::normal_distribution<float> normal;
+		RE::NiPoint3                    direction{ normal(a_rng), normal(a_rng), normal(a_rng) };
+		direction.Unitize();
+		return direction;
+	}
+
+	Motion RandomMotion(std::mt19937& a_rng, float a_radius)
+	{
+		std::uniform_real_distribution<float> unit;
+		Motion                                motion;
+		motion.start = kSnapPoint + RandomDirection(a_rng) * kStartDistance;
+		// stops anywhere in the inner third of the nock radius
+		motion.end = kSnapPoint + RandomDirection(a_rng) * (a_radius * unit(a_rng) / 3);
+		float speed = kMinSpeed + (kMaxSpeed - kMinSpeed) * unit(a_rng);
+		motion.approach_time = (motion.end - motion.start).Length() / speed;
+		return motion;
+	}
+
+	RE::NiMatrix3 AxisAngle(const RE::NiPoint3& a_axis, float a_angle)
+	{
+		auto          v = a_axis * std::sin(a_angle / 2);
+		RE::NiMatrix3 result;
+		helper::Quat2Mat(result, { std::cos(a_angle / 2), v.x, v.y, v.z });
+		return result;
+	}
+
+	vr::TrackedDevicePose_t MakePose(const RE::NiPoint3& a_position, const RE::NiPoint3& a_velocity)
+	{
+		vr::TrackedDevicePose_t pose{};
+		for (int i = 0; i < 3; i++)
+		{
+			pose.mDeviceToAbsoluteTracking.m[i][i] = 1.f;
+			pose.mDeviceToAbsoluteTracking.m[i][3] = a_position[i];
+			pose.vVelocity.v[i] = a_velocity[i];
+		}
+		pose.bPoseIsValid = true;
+		return pose;
+	}
+
+	/* The player's first person skeleton and VR nodes, as far as the plugin looks at them */
+	struct Skeleton
+	{
+		RE::NiNode     root;
+		RE::NiNode     left_hand;
+		RE::NiNode     right_hand;
+		RE::NiNode     bow;
+		RE::NiNode     room;
+		RE::NiNode     arrow_snap;
+		RE::NiNode     left_wand;
+		RE::NiNode     right_wand;
+		RE::VRNodeData vr_nodes;
+
+		Skeleton()
+		{
+			using nodecache::Node;
+			using nodecache::kNodeNames;
+			left_hand.name = kNodeNames[(size_t)Node::kLeftHand];
+			right_hand.name = kNodeNames[(size_t)Node::kRightHand];
+			bow.name = kNodeNames[(size_t)Node::kBow];
+			root.AttachChild(&left_hand);
+			root.AttachChild(&right_hand);
+			left_hand.AttachChild(&bow);
+
+			room.world.translate = { 1000.f, -2000.f, 50.f };
+			vr_nodes.RoomNode = &room;
+			vr_nodes.ArrowSnapNode = &arrow_snap;
+			vr_nodes.LeftWandNode = &left_wand;
+			vr_nodes.RightWandNode = &right_wand;
+
+			auto player = RE::PlayerCharacter::GetSingleton();
+			player->loaded3D[true] = &root;
+			player->vrNodeData = &vr_nodes;
+		}
+
+		RE::NiPoint3 ToWorld(const RE::NiPoint3& a_tracking) const
+		{
+			vr::HmdVector3_t v{ a_tracking.x, a_tracking.y, a_tracking.z };
+			auto room_space = vrinput::TrackingToRoomVector(v, Settings().units_per_meter);
+			return room.world.translate + room.world.rotate * room_space * room.world.scale;
+		}
+
+		/* Moves the nodes to where the game puts them for these controller positions */
+		void Move(const RE::NiPoint3& a_arrow_hand, const RE::NiPoint3& a_bow_hand)
+		{
+			right_wand.world.translate = ToWorld(a_arrow_hand);
+			right_hand.world.translate = right_wand.world.translate;
+			left_wand.world.translate = ToWorld(a_bow_hand);
+			left_hand.world.translate = left_wand.world.translate;
+			arrow_snap.world.translate = ToWorld(a_bow_hand + kSnapOffset);
+			bow.world.translate = arrow_snap.world.translate;
+		}
+
+		/* a_rotation: of the bow relative to the bow hand */
+		void TurnBow(const RE::NiMatrix3& a_rotation)
+		{
+			bow.world.rotate = left_hand.world.rotate * a_rotation;
+		}
+	};
+
+	/* The game's side of nocking, see the top of the file */
+	struct Game
+	{
+		bool  fire_down = false;
+		bool  drawing = false;
+		float draw_angle = 0.f;
+
+		void Step(bool a_fire_down, bool a_in_range, float a_dt)
+		{
+			if (a_fire_down && !fire_down && a_in_range) { drawing = true; }
+			fire_down = a_fire_down;
+			if (drawing) { draw_angle += kDrawRate * a_dt; }
+
+			RE::PlayerCharacter::GetSingleton()->AsActorState()->attackState =
+				drawing ? RE::ATTACK_STATE_ENUM::kBowDraw : RE::ATTACK_STATE_ENUM::kNone;
+		}
+	};
+
+	struct Result
+	{
+		int              trials = 0;
+		int              false_nocks = 0;  // detected while the game was not drawing
+		std::vector<int> frames;           // overlap to nocked, of every nocked trial
+
+		int Percentile(float a_p) const
+		{
+			return frames.empty() ? 0 : frames[(size_t)std::lround(a_p * (frames.size() - 1))];
+		}
+	};
+
+	/* One frame as the game runs it: poses and OnUpdate, input, then the game's own update, which
+	* moves the skeleton the next OnUpdate sees
+	*/
+	struct Frame
+	{
+		RE::NiPoint3 arrow_hand = {};
+		RE::NiPoint3 arrow_velocity = {};
+		RE::NiPoint3 bow_hand = {};
+		bool         button_held = false;
+	};
+
+	void RunFrame(const Frame& a_frame, Skeleton& a_skeleton, Game& a_game,
+		const RE::NiMatrix3& a_rotation_noise, float a_radius_squared, float a_dt)
+	{
+		vr::TrackedDevicePose_t poses[3] = {};
+		poses[kRightDevice] = MakePose(a_frame.arrow_hand, a_frame.arrow_velocity);
+		poses[kLeftDevice] = MakePose(a_frame.bow_hand, {});
+		vrinput::ControllerPoseCallback(nullptr, 0, poses, 3);
+
+		vr::VRControllerState_t in{};
+		in.ulButtonPressed = in.ulButtonTouched = a_frame.button_held ? kTrigger : 0;
+		auto out = in;
+		vrinput::ControllerInputCallback(kRightDevice, &in, sizeof(in), &out);
+
+		a_skeleton.Move(a_frame.arrow_hand, a_frame.bow_hand);
+		auto& snap = a_skeleton.arrow_snap.world.translate;
+		bool  in_range =
+			(a_skeleton.right_wand.world.translate - snap).SqrLength() < a_radius_squared;
+		a_game.Step(out.ulButtonPressed & kTrigger, in_range, a_dt);
+
+		a_skeleton.TurnBow(AxisAngle({ 0.f, 0.f, 1.f }, a_game.draw_angle) * a_rotation_noise);
+	}
+
+	Result Run(const Tuning& a_tuning, float a_hz, const Noise& a_noise, int a_trials,
+		Skeleton& a_skeleton, std::mt19937& a_rng)
+	{
+		ApplyIniSettings(a_tuning.ini);
+		g_settings.Update([&](Settings& a_settings) {
+			a_settings.overlap_radius = a_tuning.radius * a_tuning.radius;
+		});
+
+		float dt = 1.f / a_hz;
+		float radius = a_tuning.radius / Settings().units_per_meter;
+
+		std::normal_distribution<float> position_noise(0.f, a_noise.position);
+		std::normal_distribution<float> rotation_noise(0.f, a_noise.rotation);
+		auto                            jitter = [&](RE::NiPoint3 a_point) {
+			for (int i = 0; i < 3; i++) { a_point[i] += position_noise(a_rng); }
+			return a_point;
+		};
+		auto bow_jitter = [&]() {
+			return AxisAngle(RandomDirection(a_rng), rotation_noise(a_rng));
+		};
+
+		Result result;
+		for (int trial = 0; trial < a_trials; trial++)
+		{
+			auto motion = RandomMotion(a_rng, radius);
+			Game game;
+			a_skeleton.Move(motion.start, kBowHand);
+			a_skeleton.TurnBow(bow_jitter());
+
+			// the arrow is pulled from the quiver with the trigger, which stays held
+			QueueGameInput(ArrowInput::kEquipWithButton, vr::k_EButton_SteamVR_Trigger);
+
+			int overlap_frame = -1;
+			int frame = 0;
+			for (; frame * dt < motion.Duration(); frame++)
+			{
+				Frame f{ .bow_hand = jitter(kBowHand), .button_held = true };
+				motion.At(frame * dt, f.arrow_hand, f.arrow_velocity);
+				if (overlap_frame < 0 && (f.arrow_hand - kSnapPoint).Length() < radius)
+				{
+					overlap_frame = frame;
+				}
+				f.arrow_hand = jitter(f.arrow_hand);
+
+				bool was_drawing = game.drawing;
+				RunFrame(f, a_skeleton, game, bow_jitter(), a_tuning.radius * a_tuning.radius, dt);
+				if (g_state == ArrowState::kArrowNocked)
+				{
+					result.false_nocks += !was_drawing;
+					result.frames.push_back(frame - overlap_frame);
+					break;
+				}
+			}
+			result.trials++;
+
+			// let go, the release reaches the state machine on the next frame
+			for (int i = 0; i < 2; i++)
+			{
+				Frame f{ .bow_hand = kBowHand, .button_held = false };
+				motion.At(frame * dt, f.arrow_hand, f.arrow_velocity);
+				RunFrame(f, a_skeleton, game, {}, 0.f, dt);
+			}
+			CHECK(g_state == ArrowState::kIdle);
+		}
+
+		std::ranges::sort(result.frames);
+		return result;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	StubVRSystem vr_system;
+	vrinput::g_rightcontroller = kRightDevice;
+	vrinput::g_leftcontroller = kLeftDevice;
+	vrinput::g_IVRSystem = &vr_system;
+	vrinput::InitControllerHooks();
+	haptics::PulseDispatcher::GetSingleton()->Start(vrinput::g_IVRSystem);
+	RebindButtons(false, vr::k_EButton_SteamVR_Trigger);
+
+	// the game counts as stopped until the main menu closes
+	menuchecker::begin();
+	RE::MenuOpenCloseEvent main_menu{ "Main Menu", true };
+	RE::UI::GetSingleton()->SendEvent(&main_menu);
+	main_menu.opening = false;
+	RE::UI::GetSingleton()->SendEvent(&main_menu);
+	CHECK(!menuchecker::isGameStopped());
+
+	int          trials = argc > 1 ? std::atoi(argv[1]) : 1000;
+	Skeleton     skeleton;
+	std::mt19937 rng(1);
+
+	std::printf("%d trials per row, approach at %.1f to %.1f m/s\n", trials, kMinSpeed, kMaxSpeed);
+	std::printf("%-16s %4s %-7s %7s %13s %13s %13s %6s\n", "tuning", "Hz", "noise", "nocked",
+		"p50 fr/ms", "p90 fr/ms", "max fr/ms", "false");
+
+	for (auto& tuning : MakeTunings())
+	{
+		for (auto& noise : kNoise)
+		{
+			for (float hz : kRefreshRates)
+			{
+				auto result = Run(tuning, hz, noise, trials, skeleton, rng);
+				auto nocked = (int)result.frames.size();
+
+				auto ms = [&](int a_frames) { return a_frames * 1000.f / hz; };
+				int  p50 = result.Percentile(0.5f);
+				int  p90 = result.Percentile(0.9f);
+				int  max = result.Percentile(1.f);
+				std::printf(
+					"%-16s %4.0f %-7s %6.1f%% %4d %7.1fms %4d %7.1fms %4d %7.1fms %5.1f%%\n",
+					tuning.name, hz, noise.name, 100.f * nocked / result.trials, p50, ms(p50), p90,
+					ms(p90), max, ms(max), nocked ? 100.f * result.false_nocks / nocked : 0.f);
+
+				// without noise every approach nocks, and only once the game draws
+				if (noise.position == 0.f)
+				{
+					CHECK(nocked == result.trials);
+					CHECK(result.false_nocks == 0);
+				}
+			}
+		}
+	}
+
+	haptics::PulseDispatcher::GetSingleton()->Stop();
+	return test::Failures();
+}
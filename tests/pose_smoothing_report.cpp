@@ -0,0 +1,443 @@
+#include "test_util.h"
+#include "vrinput.h"
+
+#include <charconv>
+#include <random>
+
+/* Jitter and lag of the controller pose smoothing, vrinput::SmoothPose, on pose traces.
+*   pose_smoothing_report [trace.csv ...]
+* A trace has one controller pose per line, as the fields of vr::TrackedDevicePose_t:
+*   time in s, mDeviceToAbsoluteTracking row by row (12), vVelocity (3), vAngularVelocity (3)
+* Lines starting with # are skipped. Without arguments the report runs on synthetic traces at the
+* refresh rates of common headsets, written to CSV and read back, and checks the filter's bounds.
+*
+* Jitter: RMS movement from one pose to the next, over the samples where the tracker has reported
+* a still hand for 0.5 s. Lag: the delay of the raw trace that best matches the smoothed one, over
+* the samples where the hand moves faster than 0.5 m/s or turns faster than 1 rad/s. Settle: the
+* longest time from the hand stopping until the smoothed position is within 1 mm of the raw
+* trace's centered 100 ms average. The filter's cutoff drops with the speed, so at the stop it
+* trails by up to 1 / (2 pi kSmoothBeta) and catches up at the cutoff of a still hand.
+*/
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	constexpr double kHalfWindow = 0.05;        // s
+	constexpr double kStillSpeed = 0.1;         // m/s
+	constexpr double kStillAngularSpeed = 0.3;  // rad/s
+	constexpr double kMovingSpeed = 0.5;        // m/s
+	constexpr double kMovingAngularSpeed = 1;   // rad/s
+	constexpr double kSettleTime = 0.5;         // s
+	constexpr double kSettleDistance = 1;       // mm
+	constexpr double kMaxLag = 0.05;            // s
+	constexpr double kLagStep = 0.0001;         // s
+
+	struct Sample
+	{
+		double                  time = 0;  // s
+		vr::TrackedDevicePose_t pose = {};
+	};
+	using Trace = std::vector<Sample>;
+
+	struct Pose
+	{
+		RE::NiPoint3     position;
+		RE::NiQuaternion rotation;
+	};
+
+	Pose ToPose(const vr::TrackedDevicePose_t& a_pose)
+	{
+		auto&         m = a_pose.mDeviceToAbsoluteTracking.m;
+		RE::NiMatrix3 rotate;
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++) { rotate.entry[i][j] = m[i][j]; }
+		}
+		return { { m[0][3], m[1][3], m[2][3] }, helper::Mat2Quat(rotate) };
+	}
+
+	vr::TrackedDevicePose_t FromPose(const Pose& a_pose)
+	{
+		vr::TrackedDevicePose_t result = {};
+		RE::NiMatrix3           rotate;
+		helper::Quat2Mat(rotate, a_pose.rotation);
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				result.mDeviceToAbsoluteTracking.m[i][j] = rotate.entry[i][j];
+			}
+			result.mDeviceToAbsoluteTracking.m[i][3] = a_pose.position[i];
+		}
+		result.bPoseIsValid = true;
+		return result;
+	}
+
+	double Length(const vr::HmdVector3_t& a) { return std::hypot(a.v[0], a.v[1], a.v[2]); }
+
+	double DistanceMm(const Pose& a, const Pose& b)
+	{
+		return (a.position - b.position).Length() * 1000;
+	}
+
+	double AngleDeg(const Pose& a, const Pose& b)
+	{
+		double sin_half = std::sqrt(helper::QuatHalfAngleSinSq(a.rotation, b.rotation));
+		return 2 * std::asin(std::min(sin_half, 1.0)) * 180 / std::numbers::pi;
+	}
+
+	Trace Smooth(const Trace& a_raw)
+	{
+		vrinput::PoseFilter filter;
+		Trace               smoothed = a_raw;
+		for (auto& sample : smoothed)
+		{
+			auto since_start = std::chrono::duration<double>(sample.time);
+			vrinput::SmoothPose(filter, sample.pose,
+				Clock::time_point(std::chrono::duration_cast<Clock::duration>(since_start)));
+		}
+		return smoothed;
+	}
+
+	/* Centered moving average of the raw poses, the rotations summed on the center's hemisphere */
+	std::vector<Pose> MovingAverage(const Trace& a_raw)
+	{
+		std::vector<Pose> poses, result;
+		for (auto& sample : a_raw) { poses.push_back(ToPose(sample.pose)); }
+
+		size_t first = 0, last = 0;
+		for (size_t i = 0; i < a_raw.size(); i++)
+		{
+			while (a_raw[first].time < a_raw[i].time - kHalfWindow) { first++; }
+			while (last + 1 < a_raw.size() && a_raw[last + 1].time <= a_raw[i].time + kHalfWindow)
+			{
+				last++;
+			}
+
+			Pose   mean{ {}, { 0, 0, 0, 0 } };
+			double count = last - first + 1;
+			for (size_t j = first; j <= last; j++)
+			{
+				mean.position += poses[j].position / count;
+				auto& q = poses[j].rotation;
+				float sign = helper::QuatDot(q, poses[i].rotation) < 0 ? -1.f : 1.f;
+				mean.rotation = { mean.rotation.w + sign * q.w, mean.rotation.x + sign * q.x,
+					mean.rotation.y + sign * q.y, mean.rotation.z + sign * q.z };
+			}
+			float length = std::sqrt(helper::QuatDot(mean.rotation, mean.rotation));
+			mean.rotation = { mean.rotation.w / length, mean.rotation.x / length,
+				mean.rotation.y / length, mean.rotation.z / length };
+			result.push_back(mean);
+		}
+		return result;
+	}
+
+	/* Raw pose at a_time, interpolated between the samples around it */
+	Pose Interpolate(const Trace& a_raw, double a_time)
+	{
+		auto next = std::ranges::upper_bound(a_raw, a_time, {}, &Sample::time);
+		if (next == a_raw.begin()) { return ToPose(a_raw.front().pose); }
+		if (next == a_raw.end()) { return ToPose(a_raw.back().pose); }
+
+		auto  previous = next - 1;
+		float t = (float)((a_time - previous->time) / (next->time - previous->time));
+		Pose  a = ToPose(previous->pose), b = ToPose(next->pose);
+		return { a.position + (b.position - a.position) * t,
+			helper::QuatSlerp(a.rotation, b.rotation, t) };
+	}
+
+	struct Report
+	{
+		double raw_jitter_mm = 0, jitter_mm = 0;
+		double raw_jitter_deg = 0, jitter_deg = 0;
+		double lag_ms = NAN, angular_lag_ms = NAN;
+		double settle_ms = NAN;  // worst over the stops
+		size_t still = 0, moving = 0, turning = 0;
+	};
+
+	/* returns: the delay of a_raw that minimizes the mean square of a_distance to a_smoothed over
+	* the samples of a_indices, in ms
+	*/
+	template <typename D>
+	double Lag(const Trace& a_raw, const Trace& a_smoothed, const std::vector<size_t>& a_indices,
+		D&& a_distance)
+	{
+		if (a_indices.empty()) { return NAN; }
+
+		double best_lag = 0, best_error = INFINITY;
+		for (double lag = 0; lag <= kMaxLag; lag += kLagStep)
+		{
+			double error = 0;
+			for (size_t i : a_indices)
+			{
+				double d = a_distance(ToPose(a_smoothed[i].pose),
+					Interpolate(a_raw, a_raw[i].time - lag));
+				error += d * d;
+			}
+			if (error < best_error)
+			{
+				best_error = error;
+				best_lag = lag;
+			}
+		}
+		return best_lag * 1000;
+	}
+
+	Report Analyze(const Trace& a_raw)
+	{
+		Report report;
+		Trace  smoothed = Smooth(a_raw);
+		auto   mean = MovingAverage(a_raw);
+
+		std::vector<size_t> moving, turning;
+		double              still_since = a_raw.front().time;
+		double              stopped_at = NAN;  // while the smoothed pose has not settled
+		bool                was_moving = false;
+		for (size_t i = 0; i < a_raw.size(); i++)
+		{
+			auto&  pose = a_raw[i].pose;
+			double time = a_raw[i].time;
+			double speed = Length(pose.vVelocity), angular_speed = Length(pose.vAngularVelocity);
+			bool   still = speed < kStillSpeed && angular_speed < kStillAngularSpeed;
+			Pose   raw = ToPose(pose), filtered = ToPose(smoothed[i].pose);
+
+			if (!still) { still_since = time; }
+			else if (time - still_since >= kSettleTime)
+			{
+				Pose raw_before = ToPose(a_raw[i - 1].pose);
+				Pose filtered_before = ToPose(smoothed[i - 1].pose);
+				report.raw_jitter_mm += std::pow(DistanceMm(raw, raw_before), 2);
+				report.jitter_mm += std::pow(DistanceMm(filtered, filtered_before), 2);
+				report.raw_jitter_deg += std::pow(AngleDeg(raw, raw_before), 2);
+				report.jitter_deg += std::pow(AngleDeg(filtered, filtered_before), 2);
+				report.still++;
+			}
+
+			if (speed > kMovingSpeed) { moving.push_back(i); }
+			if (angular_speed > kMovingAngularSpeed) { turning.push_back(i); }
+
+			if (speed > kMovingSpeed) { was_moving = true; }
+			else if (was_moving && speed < kStillSpeed)
+			{
+				was_moving = false;
+				stopped_at = time;
+			}
+			if (!std::isnan(stopped_at) && DistanceMm(filtered, mean[i]) < kSettleDistance)
+			{
+				double settle = (time - stopped_at) * 1000;
+				if (!(settle <= report.settle_ms)) { report.settle_ms = settle; }
+				stopped_at = NAN;
+			}
+		}
+
+		if (report.still)
+		{
+			for (double* sum : { &report.raw_jitter_mm, &report.jitter_mm, &report.raw_jitter_deg,
+					 &report.jitter_deg })
+			{
+				*sum = std::sqrt(*sum / report.still);
+			}
+		}
+		report.moving = moving.size();
+		report.turning = turning.size();
+		report.lag_ms = Lag(a_raw, smoothed, moving, DistanceMm);
+		report.angular_lag_ms = Lag(a_raw, smoothed, turning, AngleDeg);
+		return report;
+	}
+
+	void PrintHeader()
+	{
+		std::printf("%-28s %6s %8s %19s %19s %9s %9s %9s\n", "trace", "Hz", "samples",
+			"jitter mm raw/out", "jitter deg raw/out", "lag ms", "rot lag", "settle");
+	}
+
+	void PrintReport(const std::string& a_name, const Trace& a_trace, const Report& a_report)
+	{
+		double rate = (a_trace.size() - 1) / (a_trace.back().time - a_trace.front().time);
+		std::printf("%-28s %6.1f %8zu %9.3f/%-9.3f %9.3f/%-9.3f %9.1f %9.1f %9.1f\n",
+			a_name.c_str(), rate, a_trace.size(), a_report.raw_jitter_mm, a_report.jitter_mm,
+			a_report.raw_jitter_deg, a_report.jitter_deg, a_report.lag_ms, a_report.angular_lag_ms,
+			a_report.settle_ms);
+	}
+
+	/* returns: the trace, empty if the file can not be read or a line does not parse */
+	Trace ReadTrace(const std::filesystem::path& a_path)
+	{
+		std::ifstream file(a_path);
+		if (!file) { return {}; }
+
+		Trace       trace;
+		std::string line;
+		while (std::getline(file, line))
+		{
+			if (line.empty() || line[0] == '#') { continue; }
+
+			double      fields[19];
+			const char* it = line.data();
+			const char* end = line.data() + line.size();
+			for (double& field : fields)
+			{
+				while (it < end && (*it == ' ' || *it == ',')) { it++; }
+				auto [next, error] = std::from_chars(it, end, field);
+				if (error != std::errc()) { return {}; }
+				it = next;
+			}
+
+			Sample sample;
+			sample.time = fields[0];
+			for (int i = 0; i < 12; i++)
+			{
+				sample.pose.mDeviceToAbsoluteTracking.m[i / 4][i % 4] = (float)fields[1 + i];
+			}
+			for (int i = 0; i < 3; i++)
+			{
+				sample.pose.vVelocity.v[i] = (float)fields[13 + i];
+				sample.pose.vAngularVelocity.v[i] = (float)fields[16 + i];
+			}
+			sample.pose.bPoseIsValid = true;
+			sample.pose.eTrackingResult = vr::TrackingResult_Running_OK;
+			trace.push_back(sample);
+		}
+		return trace;
+	}
+
+	void WriteTrace(const std::filesystem::path& a_path, const Trace& a_trace)
+	{
+		std::ofstream file(a_path);
+		file << "# time, mDeviceToAbsoluteTracking, vVelocity, vAngularVelocity\n";
+		for (auto& sample : a_trace)
+		{
+			auto& pose = sample.pose;
+			file << std::format("{}", sample.time);
+			for (int i = 0; i < 12; i++)
+			{
+				file << std::format(",{}", pose.mDeviceToAbsoluteTracking.m[i / 4][i % 4]);
+			}
+			for (auto v : pose.vVelocity.v) { file << std::format(",{}", v); }
+			for (auto v : pose.vAngularVelocity.v) { file << std::format(",{}", v); }
+			file << '\n';
+		}
+	}
+
+	/* Rests of 1 s between reaches of 40 cm that turn the hand by 60 degrees in 0.5 s, out and
+	* back, along minimum jerk profiles with a peak speed of 1.2 m/s and 2.6 rad/s. Tracking noise
+	* is white: a_noise_mm and a_noise_deg on the pose, 2 cm/s and 0.05 rad/s on the velocities
+	*/
+	Trace Synthetic(double a_rate, double a_seconds, double a_noise_mm, double a_noise_deg)
+	{
+		constexpr double kRest = 1, kReach = 0.5, kDistance = 0.4;
+		constexpr double kTurn = std::numbers::pi / 3;
+
+		std::mt19937_64                  engine{ 0x5eed };
+		std::normal_distribution<double> normal;
+		auto noise = [&](double a_sigma) { return a_sigma * normal(engine); };
+
+		const RE::NiPoint3 base(0.2f, 1.0f, -0.3f);
+		const RE::NiPoint3 direction = helper::VectorNormalized({ 1, 0.5f, -0.5f });
+		const RE::NiPoint3 axis = helper::VectorNormalized({ 0.3f, 1, 0.2f });
+
+		Trace trace;
+		for (double t = 0; t < a_seconds; t += 1 / a_rate)
+		{
+			// progress of the current movement and its rate, 0 while resting
+			double period = std::fmod(t, kRest + kReach);
+			bool   back = (int)(t / (kRest + kReach)) % 2;
+			double s = 0, ds = 0;
+			if (period > kRest)
+			{
+				double u = (period - kRest) / kReach;
+				s = u * u * u * (10 - 15 * u + 6 * u * u);
+				ds = 30 * u * u * (1 - u) * (1 - u) / kReach;
+			}
+			if (back)
+			{
+				s = 1 - s;
+				ds = -ds;
+			}
+
+			float turn = (float)(kTurn * s / 2);
+			Pose  truth{ base + direction * (float)(kDistance * s),
+				{ std::cos(turn), axis.x * std::sin(turn), axis.y * std::sin(turn),
+					axis.z * std::sin(turn) } };
+
+			// tracking error: a small offset and a small turn about a random axis
+			Pose measured = truth;
+			measured.position += RE::NiPoint3((float)noise(a_noise_mm / 1000),
+				(float)noise(a_noise_mm / 1000), (float)noise(a_noise_mm / 1000));
+			double       half = noise(a_noise_deg) * std::numbers::pi / 360;
+			RE::NiPoint3 e = helper::VectorNormalized(
+				{ (float)normal(engine), (float)normal(engine), (float)normal(engine) });
+			RE::NiQuaternion error((float)std::cos(half), e.x * (float)std::sin(half),
+				e.y * (float)std::sin(half), e.z * (float)std::sin(half));
+			auto& q = truth.rotation;
+			measured.rotation = { error.w * q.w - error.x * q.x - error.y * q.y - error.z * q.z,
+				error.w * q.x + error.x * q.w + error.y * q.z - error.z * q.y,
+				error.w * q.y - error.x * q.z + error.y * q.w + error.z * q.x,
+				error.w * q.z + error.x * q.y - error.y * q.x + error.z * q.w };
+
+			Sample sample{ t, FromPose(measured) };
+			for (int i = 0; i < 3; i++)
+			{
+				sample.pose.vVelocity.v[i] = (float)(direction[i] * kDistance * ds + noise(0.02));
+				sample.pose.vAngularVelocity.v[i] = (float)(axis[i] * kTurn * ds + noise(0.05));
+			}
+			trace.push_back(sample);
+		}
+		return trace;
+	}
+
+	void RunSynthetic()
+	{
+		auto directory = std::filesystem::temp_directory_path();
+
+		PrintHeader();
+		for (double rate : { 72.0, 90.0, 120.0, 144.0 })
+		{
+			for (auto [noise_mm, noise_deg] : { std::pair{ 0.5, 0.1 }, std::pair{ 2.0, 0.5 } })
+			{
+				auto name = std::format("synthetic_{}hz_{}mm.csv", rate, noise_mm);
+				auto path = directory / name;
+				auto trace = Synthetic(rate, 12, noise_mm, noise_deg);
+				WriteTrace(path, trace);
+				auto read = ReadTrace(path);
+				std::filesystem::remove(path);
+				CHECK(read.size() == trace.size());
+				if (read.empty()) { continue; }
+
+				auto report = Analyze(read);
+				PrintReport(name, read, report);
+
+				// steadier at rest, and behind by a few ms at most while moving
+				CHECK(report.still > 0 && report.moving > 0 && report.turning > 0);
+				CHECK(report.jitter_mm < report.raw_jitter_mm / 4);
+				CHECK(report.jitter_deg < report.raw_jitter_deg / 4);
+				CHECK(report.lag_ms < 10);
+				CHECK(report.angular_lag_ms < 10);
+				CHECK(report.settle_ms < 300);
+			}
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		RunSynthetic();
+		return test::Failures();
+	}
+
+	PrintHeader();
+	for (int i = 1; i < argc; i++)
+	{
+		auto trace = ReadTrace(argv[i]);
+		if (trace.size() < 2)
+		{
+			std::printf("%s: not a pose trace\n", argv[i]);
+			test::FailureCount()++;
+			continue;
+		}
+		PrintReport(std::filesystem::path(argv[i]).filename().string(), trace, Analyze(trace));
+	}
+	return test::Failures();
+}
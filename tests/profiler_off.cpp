@@ -0,0 +1,11 @@
+#include "profiler.h"
+#include "test_util.h"
+
+// the same stage as ScopeOn in profiler_test.cpp, built without ENABLE_PROFILER
+__attribute__((noinline)) void ScopeOff(uint64_t a_i)
+{
+	PROFILE_SCOPE(kOnUpdate);
+	test::DoNotOptimize(a_i);
+}
+
+__attribute__((noinline)) void BareOff(uint64_t a_i) { test::DoNotOptimize(a_i); }
@@ -0,0 +1,103 @@
+#include "profiler.h"
+#include "test_util.h"
+
+/* Histogram accuracy and the cost PROFILE_SCOPE adds to a stage. This file is built with
+* ENABLE_PROFILER, profiler_off.cpp without it, the way the plugin is built by default.
+*/
+void ScopeOff(uint64_t a_i);
+void BareOff(uint64_t a_i);
+
+namespace
+{
+	using profiler::Histogram;
+	using profiler::Stage;
+
+	// two clock reads and two relaxed atomics, with room for a slow clock source
+	constexpr double kBudgetNs = 150;
+
+	__attribute__((noinline)) void ScopeOn(uint64_t a_i)
+	{
+		PROFILE_SCOPE(kOnUpdate);
+		test::DoNotOptimize(a_i);
+	}
+
+	__attribute__((noinline)) void BareOn(uint64_t a_i) { test::DoNotOptimize(a_i); }
+
+	/* returns: least ns per call a_stage adds over a_bare, over a few runs so a preempted one does
+	* not count
+	*/
+	double Overhead(uint64_t a_iterations, void (*a_stage)(uint64_t), void (*a_bare)(uint64_t))
+	{
+		double best = 1e9;
+		for (int run = 0; run < 5; run++)
+		{
+			double stage = test::NsPerCall(a_iterations, a_stage);
+			double bare = test::NsPerCall(a_iterations, a_bare);
+			best = std::min(best, stage - bare);
+		}
+		return best;
+	}
+
+	void Buckets()
+	{
+		for (uint64_t ns = 0; ns < (1ull << 40); ns = ns * 9 / 8 + 1)
+		{
+			uint64_t floor = Histogram::BucketFloor(Histogram::BucketOf(ns));
+			CHECK(floor <= ns && ns - floor <= ns / Histogram::kSubBuckets);
+		}
+	}
+
+	void Percentiles()
+	{
+		Histogram histogram;
+		for (uint64_t ns = 1; ns <= 1000; ns++) { histogram.Record(ns); }
+
+		auto s = histogram.TakeSummary();
+		CHECK(s.count == 1000 && s.max == 1000);
+		CHECK(s.p50 <= 500 && s.p50 >= 500 - 500 / Histogram::kSubBuckets);
+		CHECK(s.p99 <= 990 && s.p99 >= 990 - 990 / Histogram::kSubBuckets);
+
+		// taking the summary clears it
+		CHECK(histogram.TakeSummary().count == 0);
+	}
+
+	void Concurrent(uint64_t a_iterations)
+	{
+		Histogram histogram;
+		{
+			std::vector<std::jthread> threads;
+			for (uint64_t t = 0; t < 4; t++)
+			{
+				threads.emplace_back([&, t] {
+					for (uint64_t i = 0; i < a_iterations; i++) { histogram.Record(i % 100 + t); }
+				});
+			}
+		}
+		auto s = histogram.TakeSummary();
+		CHECK(s.count == 4 * a_iterations);
+		CHECK(s.max == 99 + 3);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	uint64_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+
+	Buckets();
+	Percentiles();
+	Concurrent(iterations / 10);
+
+	auto&  histogram = profiler::GetHistogram(Stage::kOnUpdate);
+	double on = Overhead(iterations, ScopeOn, BareOn);
+	CHECK(histogram.TakeSummary().count == 5 * iterations);
+
+	double off = Overhead(iterations, ScopeOff, BareOff);
+	CHECK(histogram.TakeSummary().count == 0);
+
+	std::printf("PROFILE_SCOPE adds %.1f ns with ENABLE_PROFILER (budget %.0f), %.1f ns without\n",
+		on, kBudgetNs, off);
+	CHECK(on < kBudgetNs);
+	CHECK(off < 2);
+
+	return test::Failures();
+}
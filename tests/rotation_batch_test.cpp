@@ -0,0 +1,361 @@
+#include "helper_math.h"
+#include "rotation_batch.h"
+#include "test_util.h"
+
+#include <random>
+
+/* The batched rotation kernels against the scalar helpers they stand in for, and both slerps
+* against one in double. LegacySlerpQuat is slerpQuat as it was before QuatSlerp, whose linear
+* path normalized by q3x + q3x instead of q3x * q3x; the slerp sweep has to reject it.
+* Then the time per rotation of each, scalar and batched.
+*/
+namespace
+{
+	using RE::NiMatrix3;
+	using RE::NiQuaternion;
+
+	constexpr size_t kCount = 4099;  // not a multiple of the lane count, so the tail is covered
+
+	struct Random
+	{
+		std::mt19937_64 engine{ 0x5eed };
+
+		double Uniform(double a_min, double a_max)
+		{
+			return std::uniform_real_distribution<double>(a_min, a_max)(engine);
+		}
+
+		// uniform over rotations: a normalized 4D gaussian
+		NiQuaternion Quat()
+		{
+			std::normal_distribution<double> normal;
+			double q[4], length = 0;
+			for (auto& c : q)
+			{
+				c = normal(engine);
+				length += c * c;
+			}
+			length = std::sqrt(length);
+			return { (float)(q[0] / length), (float)(q[1] / length), (float)(q[2] / length),
+				(float)(q[3] / length) };
+		}
+
+		// a_q turned by a_angle about a random axis
+		NiQuaternion Near(const NiQuaternion& a_q, double a_angle)
+		{
+			auto   axis = Quat();
+			double length = std::sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+			double s = std::sin(a_angle / 2) / length, c = std::cos(a_angle / 2);
+			double x = axis.x * s, y = axis.y * s, z = axis.z * s;
+			return { (float)(a_q.w * c - a_q.x * x - a_q.y * y - a_q.z * z),
+				(float)(a_q.w * x + a_q.x * c + a_q.y * z - a_q.z * y),
+				(float)(a_q.w * y - a_q.x * z + a_q.y * c + a_q.z * x),
+				(float)(a_q.w * z + a_q.x * y - a_q.y * x + a_q.z * c) };
+		}
+	};
+
+	struct DQuat
+	{
+		double w, x, y, z;
+	};
+
+	DQuat SlerpReference(const NiQuaternion& a_q1, const NiQuaternion& a_q2, double a_interp)
+	{
+		DQuat  q1{ a_q1.w, a_q1.x, a_q1.y, a_q1.z }, q2{ a_q2.w, a_q2.x, a_q2.y, a_q2.z };
+		double dot = q1.w * q2.w + q1.x * q2.x + q1.y * q2.y + q1.z * q2.z;
+		if (dot < 0)
+		{
+			q2 = { -q2.w, -q2.x, -q2.y, -q2.z };
+			dot = -dot;
+		}
+		double theta_0 = std::acos(std::min(dot, 1.0));
+		double s0 = 1 - a_interp, s1 = a_interp;
+		if (theta_0 > 1e-9)
+		{
+			s0 = std::sin((1 - a_interp) * theta_0) / std::sin(theta_0);
+			s1 = std::sin(a_interp * theta_0) / std::sin(theta_0);
+		}
+		DQuat  q{ s0 * q1.w + s1 * q2.w, s0 * q1.x + s1 * q2.x, s0 * q1.y + s1 * q2.y,
+			s0 * q1.z + s1 * q2.z };
+		double length = std::sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+		return { q.w / length, q.x / length, q.y / length, q.z / length };
+	}
+
+	/* returns: largest entry difference between a_m and the rotation of a unit a_q, infinite for
+	* NaN
+	*/
+	double MatrixError(const NiMatrix3& a_m, const DQuat& a_q)
+	{
+		auto [w, x, y, z] = a_q;
+		double reference[3][3] = { { 1 - 2 * (y * y + z * z), 2 * (x * y - z * w),
+									   2 * (x * z + y * w) },
+			{ 2 * (x * y + z * w), 1 - 2 * (x * x + z * z), 2 * (y * z - x * w) },
+			{ 2 * (x * z - y * w), 2 * (y * z + x * w), 1 - 2 * (x * x + y * y) } };
+		double error = 0;
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				double e = std::abs(a_m.entry[i][j] - reference[i][j]);
+				error = std::isnan(e) ? INFINITY : std::max(error, e);
+			}
+		}
+		return error;
+	}
+
+	// copied from the plugin before QuatSlerp, including the normalization bug
+	void LegacySlerpQuat(float interp, NiQuaternion& q1, NiQuaternion& q2, NiMatrix3& out)
+	{
+		double dot = q1.w * q2.w + q1.x * q2.x + q1.y * q2.y + q1.z * q2.z;
+		if (dot < 0.0f)
+		{
+			q2 = { -q2.w, -q2.x, -q2.y, -q2.z };
+			dot = -dot;
+		}
+
+		float q3w, q3x, q3y, q3z;
+		if (dot > 0.9995)
+		{
+			q3w = q1.w + interp * (q2.w - q1.w);
+			q3x = q1.x + interp * (q2.x - q1.x);
+			q3y = q1.y + interp * (q2.y - q1.y);
+			q3z = q1.z + interp * (q2.z - q1.z);
+			float length = sqrtf(q3w * q3w + q3x + q3x + q3y * q3y + q3z * q3z);
+			q3w /= length;
+			q3x /= length;
+			q3y /= length;
+			q3z /= length;
+		}
+		else
+		{
+			float theta_0 = acosf(dot);
+			float theta = theta_0 * interp;
+			float sin_theta = sinf(theta);
+			float sin_theta_0 = sinf(theta_0);
+			float s0 = cosf(theta) - dot * sin_theta / sin_theta_0;
+			float s1 = sin_theta / sin_theta_0;
+			q3w = (s0 * q1.w) + (s1 * q2.w);
+			q3x = (s0 * q1.x) + (s1 * q2.x);
+			q3y = (s0 * q1.y) + (s1 * q2.y);
+			q3z = (s0 * q1.z) + (s1 * q2.z);
+		}
+		helper::Quat2Mat(out, { q3w, q3x, q3y, q3z });
+	}
+
+	constexpr float kInterps[] = { 0.f, 0.02f, 0.2f, 0.5f, 0.9f, 1.f };
+
+	struct Pairs
+	{
+		std::vector<NiQuaternion> from, to;
+	};
+
+	// half far apart, half within the linear interpolation threshold, down to 1e-5 rad
+	Pairs MakePairs(Random& a_random)
+	{
+		Pairs pairs;
+		for (size_t i = 0; i < kCount; i++)
+		{
+			auto q = a_random.Quat();
+			pairs.from.push_back(q);
+			double angle = std::pow(10, a_random.Uniform(-5, -1.2));
+			pairs.to.push_back(i % 2 ? a_random.Near(q, angle) : a_random.Quat());
+		}
+		return pairs;
+	}
+
+	/* returns: largest matrix error of a_slerp(from, to, interp) over the pairs and kInterps */
+	template <typename F>
+	double SlerpSweepError(const Pairs& a_pairs, F&& a_slerp)
+	{
+		double worst = 0;
+		for (float interp : kInterps)
+		{
+			std::vector<NiMatrix3> out = a_slerp(a_pairs, interp);
+			for (size_t i = 0; i < kCount; i++)
+			{
+				auto reference = SlerpReference(a_pairs.from[i], a_pairs.to[i], interp);
+				worst = std::max(worst, MatrixError(out[i], reference));
+			}
+		}
+		return worst;
+	}
+
+	std::vector<NiMatrix3> ScalarSlerp(const Pairs& a_pairs, float a_interp)
+	{
+		std::vector<NiMatrix3> out(kCount);
+		for (size_t i = 0; i < kCount; i++)
+		{
+			helper::Quat2Mat(out[i], helper::QuatSlerp(a_pairs.from[i], a_pairs.to[i], a_interp));
+		}
+		return out;
+	}
+
+	std::vector<NiMatrix3> BatchSlerp(const Pairs& a_pairs, float a_interp)
+	{
+		std::vector<NiQuaternion> quats(kCount);
+		std::vector<NiMatrix3>    out(kCount);
+		helper::QuatSlerpBatch(a_pairs.from, a_pairs.to, a_interp, quats);
+		helper::Quat2MatBatch(quats, out);
+		return out;
+	}
+
+	std::vector<NiMatrix3> LegacySlerp(const Pairs& a_pairs, float a_interp)
+	{
+		std::vector<NiMatrix3> out(kCount);
+		for (size_t i = 0; i < kCount; i++)
+		{
+			auto from = a_pairs.from[i], to = a_pairs.to[i];
+			LegacySlerpQuat(a_interp, from, to, out[i]);
+		}
+		return out;
+	}
+
+	void CheckConversions(Random& a_random)
+	{
+		std::vector<NiQuaternion> quats;
+		for (size_t i = 0; i < kCount; i++) { quats.push_back(a_random.Quat()); }
+
+		// one slot past the end, which the batch must leave alone
+		std::vector<NiMatrix3> matrices(kCount + 1);
+		matrices.back().entry[0][0] = 42;
+		helper::Quat2MatBatch(std::span(quats), std::span(matrices).first(kCount + 1));
+		CHECK(matrices.back().entry[0][0] == 42);
+
+		float worst = 0;
+		for (size_t i = 0; i < kCount; i++)
+		{
+			NiMatrix3 scalar;
+			helper::Quat2Mat(scalar, quats[i]);
+			for (int r = 0; r < 3; r++)
+			{
+				for (int c = 0; c < 3; c++)
+				{
+					worst = std::max(worst, std::abs(scalar.entry[r][c] - matrices[i].entry[r][c]));
+				}
+			}
+		}
+		std::printf("Quat2MatBatch vs Quat2Mat: max difference %.3g\n", worst);
+		CHECK(worst <= std::numeric_limits<float>::epsilon());
+
+		// every branch of Mat2Quat, each bit for bit
+		std::vector<NiQuaternion> back(kCount + 1);
+		back.back().w = 42;
+		helper::Mat2QuatBatch(std::span(matrices).first(kCount), back);
+		CHECK(back.back().w == 42);
+
+		size_t mismatches = 0;
+		int    branches[4] = {};
+		for (size_t i = 0; i < kCount; i++)
+		{
+			auto& m = matrices[i].entry;
+			auto  q = helper::Mat2Quat(matrices[i]);
+			mismatches += q.w != back[i].w || q.x != back[i].x || q.y != back[i].y ||
+				q.z != back[i].z;
+			branches[m[0][0] + m[1][1] + m[2][2] > 0 ? 0 :
+					m[0][0] > m[1][1] && m[0][0] > m[2][2] ? 1 :
+					m[1][1] > m[2][2]                       ? 2 :
+															  3]++;
+		}
+		std::printf("Mat2QuatBatch vs Mat2Quat: %zu of %zu differ, branches w %d x %d y %d z %d\n",
+			mismatches, kCount, branches[0], branches[1], branches[2], branches[3]);
+		CHECK(mismatches == 0);
+		for (int count : branches) { CHECK(count > 0); }
+	}
+
+	void CheckSlerp(Random& a_random)
+	{
+		auto pairs = MakePairs(a_random);
+
+		double scalar = SlerpSweepError(pairs, ScalarSlerp);
+		double batch = SlerpSweepError(pairs, BatchSlerp);
+		double legacy = SlerpSweepError(pairs, LegacySlerp);
+		std::printf("slerp max matrix error vs double: QuatSlerp %.3g, QuatSlerpBatch %.3g, "
+					"legacy slerpQuat %.3g\n",
+			scalar, batch, legacy);
+
+		// the linear interpolation of rotations within dot 0.9995 is off by up to 1e-6 on its own
+		constexpr double kTolerance = 2e-6;
+		CHECK(scalar < kTolerance);
+		CHECK(batch < kTolerance);
+		CHECK(!(legacy < kTolerance));
+
+		// the batch against the scalar form directly
+		std::vector<NiQuaternion> quats(kCount);
+		float                     worst = 0;
+		for (float interp : kInterps)
+		{
+			helper::QuatSlerpBatch(pairs.from, pairs.to, interp, quats);
+			for (size_t i = 0; i < kCount; i++)
+			{
+				auto q = helper::QuatSlerp(pairs.from[i], pairs.to[i], interp);
+				worst = std::max({ worst, std::abs(q.w - quats[i].w), std::abs(q.x - quats[i].x),
+					std::abs(q.y - quats[i].y), std::abs(q.z - quats[i].z) });
+			}
+		}
+		std::printf("QuatSlerpBatch vs QuatSlerp: max difference %.3g\n", worst);
+		CHECK(worst < 3e-7f);
+	}
+
+	void Benchmark(uint64_t a_iterations, Random& a_random)
+	{
+		constexpr size_t          kBatch = 1024;
+		std::vector<NiQuaternion> from, to, quats(kBatch);
+		std::vector<NiMatrix3>    matrices(kBatch);
+		for (size_t i = 0; i < kBatch; i++)
+		{
+			from.push_back(a_random.Quat());
+			to.push_back(i % 2 ? a_random.Near(from.back(), 0.01) : a_random.Quat());
+			helper::Quat2Mat(matrices[i], from.back());
+		}
+
+		auto per_rotation = [&](auto&& a_func) {
+			return test::NsPerCall(a_iterations, [&](uint64_t) {
+				a_func();
+				test::DoNotOptimize(quats.front());
+				test::DoNotOptimize(matrices.front());
+			}) / kBatch;
+		};
+
+		struct Row
+		{
+			const char* name;
+			double      scalar, batch;
+		};
+		Row rows[] = {
+			{ "Mat2Quat", per_rotation([&] {
+				  for (size_t i = 0; i < kBatch; i++) { quats[i] = helper::Mat2Quat(matrices[i]); }
+			  }),
+				per_rotation([&] { helper::Mat2QuatBatch(matrices, quats); }) },
+			{ "Quat2Mat", per_rotation([&] {
+				  for (size_t i = 0; i < kBatch; i++) { helper::Quat2Mat(matrices[i], from[i]); }
+			  }),
+				per_rotation([&] { helper::Quat2MatBatch(from, matrices); }) },
+			{ "QuatSlerp", per_rotation([&] {
+				  for (size_t i = 0; i < kBatch; i++)
+				  {
+					  quats[i] = helper::QuatSlerp(from[i], to[i], 0.3f);
+				  }
+			  }),
+				per_rotation([&] { helper::QuatSlerpBatch(from, to, 0.3f, quats); }) },
+		};
+
+		std::printf("\n%-10s %12s %12s %8s\n", "ns/rot", "scalar", "batch", "speedup");
+		for (auto& row : rows)
+		{
+			std::printf("%-10s %12.2f %12.2f %7.1fx\n", row.name, row.scalar, row.batch,
+				row.scalar / row.batch);
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	uint64_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000;
+
+	Random random;
+	CheckConversions(random);
+	CheckSlerp(random);
+	Benchmark(iterations, random);
+
+	return test::Failures();
+}
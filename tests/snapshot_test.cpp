@@ -0,0 +1,112 @@
+#include "snapshot.h"
+#include "test_util.h"
+
+/* Readers on several threads against a writer publishing as fast as it can, for both reclamation
+* schemes. A version freed while a reader still holds it shows up as a bad canary, one never freed
+* shows up in the live count once the snapshot is gone.
+*/
+namespace
+{
+	constexpr uint64_t kCanary = 0x5eed'a770'c0de'f00d;
+
+	std::atomic<int> g_live = 0;
+
+	struct Versioned
+	{
+		Versioned() { g_live++; }
+		Versioned(const Versioned& a_other) : value(a_other.value) { g_live++; }
+		~Versioned()
+		{
+			canary = 0;
+			g_live--;
+		}
+
+		uint64_t value = 0;
+		uint64_t canary = kCanary;
+	};
+
+	template <typename R>
+	void Stress(const char* a_name, uint64_t a_publishes, int a_readers)
+	{
+		{
+			Snapshot<Versioned, R> snapshot;
+			std::atomic<bool>      done = false;
+			std::atomic<uint64_t>  bad = 0;
+			std::atomic<uint64_t>  reads = 0;
+
+			std::vector<std::jthread> readers;
+			for (int i = 0; i < a_readers; i++)
+			{
+				readers.emplace_back([&] {
+					uint64_t last = 0;
+					uint64_t count = 0;
+					while (!done.load(std::memory_order_relaxed))
+					{
+						typename Snapshot<Versioned, R>::Guard guard(snapshot);
+						auto                                   first = snapshot.Load();
+						// nested pins and a second load in the same guard stay valid too
+						auto reader = snapshot.Read();
+						if (first->canary != kCanary || reader->canary != kCanary ||
+							first->value < last || reader->value < first->value)
+						{
+							bad++;
+						}
+						last = first->value;
+						count++;
+					}
+					reads += count;
+				});
+			}
+
+			auto start = std::chrono::steady_clock::now();
+			for (uint64_t i = 0; i < a_publishes; i++)
+			{
+				if (i % 2) { snapshot.Update([](Versioned& a_next) { a_next.value++; }); }
+				else
+				{
+					auto next = std::make_unique<Versioned>(*snapshot.Load());
+					next->value++;
+					snapshot.Publish(std::move(next));
+				}
+			}
+			std::chrono::duration<double, std::nano> ns = std::chrono::steady_clock::now() - start;
+			done = true;
+			readers.clear();
+
+			CHECK(bad == 0);
+			CHECK(snapshot.Load()->value == a_publishes);
+
+			// with the readers gone the next publish frees everything retired so far
+			snapshot.Update([](Versioned&) {});
+			CHECK(snapshot.Retired() == 0);
+			CHECK(g_live == 1);
+
+			std::printf("  %-18s %8.0f ns/publish %12llu reads\n", a_name, ns.count() / a_publishes,
+				(unsigned long long)reads.load());
+		}
+		CHECK(g_live == 0);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	uint64_t publishes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+	std::printf("%llu publishes, 3 reader threads:\n", (unsigned long long)publishes);
+	Stress<ReaderCount>("reader count", publishes, 3);
+	Stress<EpochReclamation>("epoch", publishes, 3);
+
+	// a publish from inside a guard must not free the version the guard pinned
+	EpochPtr<Versioned> settings;
+	{
+		EpochPtr<Versioned>::Guard guard(settings);
+		auto                       pinned = settings.Load();
+		settings.Update([](Versioned& a_next) { a_next.value = 1; });
+		CHECK(pinned->canary == kCanary && pinned->value == 0);
+		CHECK(settings.Retired() == 1);
+	}
+	settings.Update([](Versioned& a_next) { a_next.value = 2; });
+	CHECK(settings.Retired() == 0);
+
+	return test::Failures();
+}
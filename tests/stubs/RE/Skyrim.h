@@ -0,0 +1,539 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* Host stand-in for the part of CommonLibSSE the plugin headers name. Math types behave like the
+* real ones, game objects are empty shells: anything that would need the running game is either
+* absent or returns nothing. The exception is the player, whose skeleton, attack state and stamina
+* a host test can set up (see PlayerCharacter).
+*/
+namespace RE
+{
+	using FormID = std::uint32_t;
+
+	class NiPoint3
+	{
+	public:
+		constexpr NiPoint3() = default;
+		constexpr NiPoint3(float a_x, float a_y, float a_z) : x(a_x), y(a_y), z(a_z) {}
+
+		float&       operator[](std::size_t a_idx) { return (&x)[a_idx]; }
+		const float& operator[](std::size_t a_idx) const { return (&x)[a_idx]; }
+
+		NiPoint3 operator+(const NiPoint3& a_rhs) const
+		{
+			return { x + a_rhs.x, y + a_rhs.y, z + a_rhs.z };
+		}
+		NiPoint3 operator-(const NiPoint3& a_rhs) const
+		{
+			return { x - a_rhs.x, y - a_rhs.y, z - a_rhs.z };
+		}
+		NiPoint3 operator-() const { return { -x, -y, -z }; }
+		NiPoint3 operator*(float a_scalar) const
+		{
+			return { x * a_scalar, y * a_scalar, z * a_scalar };
+		}
+		NiPoint3 operator/(float a_scalar) const { return *this * (1.f / a_scalar); }
+
+		NiPoint3& operator+=(const NiPoint3& a_rhs) { return *this = *this + a_rhs; }
+		NiPoint3& operator-=(const NiPoint3& a_rhs) { return *this = *this - a_rhs; }
+		NiPoint3& operator*=(float a_scalar) { return *this = *this * a_scalar; }
+
+		float Dot(const NiPoint3& a_rhs) const { return x * a_rhs.x + y * a_rhs.y + z * a_rhs.z; }
+		NiPoint3 Cross(const NiPoint3& a_rhs) const
+		{
+			return { y * a_rhs.z - z * a_rhs.y, z * a_rhs.x - x * a_rhs.z,
+				x * a_rhs.y - y * a_rhs.x };
+		}
+		float    SqrLength() const { return Dot(*this); }
+		float    Length() const { return std::sqrt(SqrLength()); }
+		float    Unitize()
+		{
+			float length = Length();
+			if (length > 1e-6f) { *this = *this / length; }
+			else { *this = {}; }
+			return length;
+		}
+		NiPoint3 UnitCross(const NiPoint3& a_rhs) const
+		{
+			auto cross = Cross(a_rhs);
+			cross.Unitize();
+			return cross;
+		}
+
+		float x = 0.f;
+		float y = 0.f;
+		float z = 0.f;
+	};
+
+	class NiMatrix3
+	{
+	public:
+		NiMatrix3()
+		{
+			for (int i = 0; i < 3; i++)
+			{
+				for (int j = 0; j < 3; j++) { entry[i][j] = i == j ? 1.f : 0.f; }
+			}
+		}
+		NiMatrix3(const NiPoint3& a_x, const NiPoint3& a_y, const NiPoint3& a_z)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				entry[0][j] = a_x[j];
+				entry[1][j] = a_y[j];
+				entry[2][j] = a_z[j];
+			}
+		}
+
+		NiMatrix3 Transpose() const
+		{
+			NiMatrix3 result;
+			for (int i = 0; i < 3; i++)
+			{
+				for (int j = 0; j < 3; j++) { result.entry[i][j] = entry[j][i]; }
+			}
+			return result;
+		}
+
+		NiMatrix3 operator*(const NiMatrix3& a_rhs) const
+		{
+			NiMatrix3 result;
+			for (int i = 0; i < 3; i++)
+			{
+				for (int j = 0; j < 3; j++)
+				{
+					result.entry[i][j] = entry[i][0] * a_rhs.entry[0][j] +
+						entry[i][1] * a_rhs.entry[1][j] + entry[i][2] * a_rhs.entry[2][j];
+				}
+			}
+			return result;
+		}
+
+		NiPoint3 operator*(const NiPoint3& a_rhs) const
+		{
+			return { entry[0][0] * a_rhs.x + entry[0][1] * a_rhs.y + entry[0][2] * a_rhs.z,
+				entry[1][0] * a_rhs.x + entry[1][1] * a_rhs.y + entry[1][2] * a_rhs.z,
+				entry[2][0] * a_rhs.x + entry[2][1] * a_rhs.y + entry[2][2] * a_rhs.z };
+		}
+
+		float entry[3][3];
+	};
+
+	class NiQuaternion
+	{
+	public:
+		constexpr NiQuaternion() = default;
+		constexpr NiQuaternion(float a_w, float a_x, float a_y, float a_z) :
+			w(a_w), x(a_x), y(a_y), z(a_z)
+		{}
+
+		float w = 1.f;
+		float x = 0.f;
+		float y = 0.f;
+		float z = 0.f;
+	};
+
+	class NiTransform
+	{
+	public:
+		NiMatrix3 rotate;
+		NiPoint3  translate;
+		float     scale = 1.f;
+	};
+
+	struct NiColor
+	{
+		float red = 0.f;
+		float green = 0.f;
+		float blue = 0.f;
+	};
+
+	struct NiColorA
+	{
+		float red = 0.f;
+		float green = 0.f;
+		float blue = 0.f;
+		float alpha = 0.f;
+	};
+
+	template <class T>
+	class NiPointer
+	{
+	public:
+		NiPointer(T* a_ptr = nullptr) : ptr(a_ptr) {}
+
+		T*       get() const { return ptr; }
+		T*       operator->() const { return ptr; }
+		explicit operator bool() const { return ptr != nullptr; }
+
+	private:
+		T* ptr;
+	};
+
+	/* Interned like the game's, equal strings share one data pointer */
+	class BSFixedString
+	{
+	public:
+		BSFixedString() : BSFixedString(std::string_view()) {}
+		BSFixedString(const char* a_string) :
+			BSFixedString(std::string_view(a_string ? a_string : ""))
+		{}
+		BSFixedString(std::string_view a_string) : text(Intern(a_string)) {}
+
+		const char* c_str() const { return text->c_str(); }
+		const char* data() const { return text->c_str(); }
+		bool        empty() const { return text->empty(); }
+
+		bool operator==(const BSFixedString& a_rhs) const { return text == a_rhs.text; }
+
+	private:
+		static const std::string* Intern(std::string_view a_string)
+		{
+			static std::mutex                         lock;
+			static std::set<std::string, std::less<>> pool;
+
+			std::scoped_lock guard(lock);
+			auto             it = pool.find(a_string);
+			if (it == pool.end()) { it = pool.emplace(a_string).first; }
+			return &*it;
+		}
+
+		const std::string* text;
+	};
+
+	class NiProperty
+	{
+	public:
+		virtual ~NiProperty() = default;
+	};
+
+	class BSShaderProperty : public NiProperty
+	{};
+
+	class BSGeometry;
+
+	class NiNode;
+
+	class NiAVObject
+	{
+	public:
+		virtual ~NiAVObject() = default;
+
+		virtual BSGeometry* AsGeometry() { return nullptr; }
+		virtual NiAVObject* GetObjectByName(const BSFixedString& a_name)
+		{
+			return name == a_name ? this : nullptr;
+		}
+
+		BSFixedString name;
+		NiNode*       parent = nullptr;
+		NiTransform   local;
+		NiTransform   world;
+	};
+
+	/* Searches its children by name. Nothing computes world transforms, whoever builds the tree
+	* sets them
+	*/
+	class NiNode : public NiAVObject
+	{
+	public:
+		NiAVObject* GetObjectByName(const BSFixedString& a_name) override
+		{
+			if (name == a_name) { return this; }
+			for (auto child : children)
+			{
+				if (auto found = child->GetObjectByName(a_name)) { return found; }
+			}
+			return nullptr;
+		}
+
+		void AttachChild(NiAVObject* a_child)
+		{
+			a_child->parent = this;
+			children.push_back(a_child);
+		}
+
+		std::vector<NiAVObject*> children;
+	};
+
+	class BSGeometry : public NiAVObject
+	{
+	public:
+		struct States
+		{
+			enum State
+			{
+				kProperty,
+				kEffect,
+				kTotal
+			};
+		};
+
+		NiPointer<NiProperty> properties[States::kTotal];
+	};
+
+	template <class To, class From>
+	To netimmerse_cast(From* a_from)
+	{
+		return dynamic_cast<To>(a_from);
+	}
+
+	enum class FormType : std::uint8_t
+	{
+		None = 0,
+		Ammo = 42,
+		Weapon = 41,
+		ArtObject = 125,
+	};
+
+	enum class ActorValue : std::uint32_t
+	{
+		kStamina = 26,
+	};
+
+	class TESForm
+	{
+	public:
+		static TESForm* LookupByID(FormID) { return nullptr; }
+
+		template <class T>
+		T* As()
+		{
+			return formType == T::FORMTYPE ? static_cast<T*>(this) : nullptr;
+		}
+
+		FormType GetFormType() const { return formType; }
+		FormID   GetFormID() const { return formID; }
+		bool     IsAmmo() const { return formType == FormType::Ammo; }
+		bool     IsWeapon() const { return formType == FormType::Weapon; }
+
+		FormType formType = FormType::None;
+		FormID   formID = 0;
+	};
+
+	class SpellItem : public TESForm
+	{};
+
+	class TESAmmo : public TESForm
+	{
+	public:
+		static constexpr auto FORMTYPE = FormType::Ammo;
+
+		bool IsBolt() const { return bolt; }
+
+		bool bolt = false;
+	};
+
+	class TESObjectWEAP : public TESForm
+	{
+	public:
+		static constexpr auto FORMTYPE = FormType::Weapon;
+
+		bool IsBow() const { return bow; }
+
+		bool bow = false;
+	};
+
+	class BGSArtObject : public TESForm
+	{
+	public:
+		static constexpr auto FORMTYPE = FormType::ArtObject;
+	};
+
+	class BSSoundHandle
+	{};
+
+	class Setting
+	{
+	public:
+		float GetFloat() const { return value; }
+		bool  GetBool() const { return value != 0.f; }
+
+		float value = 0.f;
+	};
+
+	/* No game ini, callers keep their defaults */
+	inline Setting* GetINISetting(const char*) { return nullptr; }
+
+	enum class ATTACK_STATE_ENUM : std::uint32_t
+	{
+		kNone = 0,
+		kDraw = 1,
+		kSwing = 2,
+		kHit = 3,
+		kNextAttack = 4,
+		kFollowThrough = 5,
+		kBash = 6,
+		kBowDraw = 8,
+		kBowAttached = 9,
+		kBowDrawn = 10,
+		kBowReleasing = 11,
+		kBowReleased = 12,
+		kBowNextAttack = 13,
+		kBowFollowThrough = 14,
+		kFire = 15,
+		kFiring = 16,
+		kFired = 17,
+	};
+
+	class ActorState
+	{
+	public:
+		ATTACK_STATE_ENUM GetAttackState() const { return attackState; }
+
+		ATTACK_STATE_ENUM attackState = ATTACK_STATE_ENUM::kNone;
+	};
+
+	class ActorValueOwner
+	{
+	public:
+		float GetActorValue(ActorValue) const { return stamina; }
+
+		float stamina = 100.f;  // the only actor value the plugin reads
+	};
+
+	class TESObjectREFR : public TESForm
+	{};
+
+	class Actor : public TESObjectREFR
+	{
+	public:
+		ActorState*      AsActorState() { return &actorState; }
+		ActorValueOwner* AsActorValueOwner() { return &actorValues; }
+
+		TESForm* GetEquippedObject(bool) const { return nullptr; }
+		TESAmmo* GetCurrentAmmo() const { return nullptr; }
+
+		void ApplyArtObject(BGSArtObject*, float, TESObjectREFR*, bool, bool, NiAVObject*) {}
+
+		ActorState      actorState;
+		ActorValueOwner actorValues;
+	};
+
+	struct VRNodeData
+	{
+		NiPointer<NiNode> RoomNode;
+		NiPointer<NiNode> ArrowSnapNode;
+		NiPointer<NiNode> LeftWandNode;
+		NiPointer<NiNode> RightWandNode;
+	};
+
+	/* No 3D until a test attaches some: until then node lookups and world transforms fall back */
+	class PlayerCharacter : public Actor
+	{
+	public:
+		static PlayerCharacter* GetSingleton()
+		{
+			static PlayerCharacter singleton;
+			return &singleton;
+		}
+
+		NiAVObject* Get3D(bool a_first_person) const { return loaded3D[a_first_person]; }
+		VRNodeData* GetVRNodeData() const { return vrNodeData; }
+
+		NiNode*     loaded3D[2] = {};  // third person, first person
+		VRNodeData* vrNodeData = nullptr;
+	};
+
+	template <class T>
+	class BSTSmartPointer
+	{
+	public:
+		T*       get() const { return ptr; }
+		explicit operator bool() const { return ptr != nullptr; }
+
+		T* ptr = nullptr;
+	};
+
+	struct TESEquipEvent
+	{
+		BSTSmartPointer<TESObjectREFR> actor;
+		FormID                         baseObject = 0;
+		std::uint32_t                  originalRefr = 0;
+		std::uint16_t                  uniqueID = 0;
+		bool                           equipped = false;
+	};
+
+	struct TESObjectLoadedEvent
+	{
+		FormID formID = 0;
+		bool   loaded = false;
+	};
+
+	struct MenuOpenCloseEvent
+	{
+		BSFixedString menuName;
+		bool          opening = false;
+	};
+
+	enum class BSEventNotifyControl
+	{
+		kContinue = 0,
+		kStop = 1,
+	};
+
+	template <class Event>
+	class BSTEventSource;
+
+	template <class Event>
+	class BSTEventSink
+	{
+	public:
+		virtual ~BSTEventSink() = default;
+		virtual BSEventNotifyControl ProcessEvent(const Event*, BSTEventSource<Event>*) = 0;
+	};
+
+	template <class Event>
+	class BSTEventSource
+	{
+	public:
+		void SendEvent(const Event* a_event)
+		{
+			for (auto sink : sinks)
+			{
+				if (sink->ProcessEvent(a_event, this) == BSEventNotifyControl::kStop) { break; }
+			}
+		}
+
+		void AddEventSink(BSTEventSink<Event>* a_sink) { sinks.push_back(a_sink); }
+
+	private:
+		std::vector<BSTEventSink<Event>*> sinks;
+	};
+
+	class ScriptEventSourceHolder :
+		public BSTEventSource<TESEquipEvent>,
+		public BSTEventSource<TESObjectLoadedEvent>
+	{
+	public:
+		static ScriptEventSourceHolder* GetSingleton()
+		{
+			static ScriptEventSourceHolder singleton;
+			return &singleton;
+		}
+
+		template <class Event>
+		void AddEventSink(BSTEventSink<Event>* a_sink)
+		{
+			BSTEventSource<Event>::AddEventSink(a_sink);
+		}
+	};
+
+	class UI : public BSTEventSource<MenuOpenCloseEvent>
+	{
+	public:
+		static UI* GetSingleton()
+		{
+			static UI singleton;
+			return &singleton;
+		}
+	};
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <fmt/format.h>
+
+#include <cstdio>
+#include <functional>
+
+/* Host stand-in for the SKSE logging and task interfaces. Warnings and errors go to stderr, info
+* and below are dropped so benchmark output stays readable. Tasks run right away on the caller.
+*/
+namespace SKSE
+{
+	namespace log
+	{
+		namespace detail
+		{
+			template <class... Args>
+			void Print(const char* a_level, fmt::format_string<Args...> a_fmt, Args&&... a_args)
+			{
+				std::fprintf(stderr, "[%s] %s\n", a_level,
+					fmt::format(a_fmt, std::forward<Args>(a_args)...).c_str());
+			}
+		}
+
+		template <class... Args>
+		void trace(fmt::format_string<Args...>, Args&&...)
+		{}
+
+		template <class... Args>
+		void debug(fmt::format_string<Args...>, Args&&...)
+		{}
+
+		template <class... Args>
+		void info(fmt::format_string<Args...>, Args&&...)
+		{}
+
+		template <class... Args>
+		void warn(fmt::format_string<Args...> a_fmt, Args&&... a_args)
+		{
+			detail::Print("warning", a_fmt, std::forward<Args>(a_args)...);
+		}
+
+		template <class... Args>
+		void error(fmt::format_string<Args...> a_fmt, Args&&... a_args)
+		{
+			detail::Print("error", a_fmt, std::forward<Args>(a_args)...);
+		}
+	}
+
+	class TaskInterface
+	{
+	public:
+		void AddTask(std::function<void()> a_task) const { a_task(); }
+	};
+
+	inline const TaskInterface* GetTaskInterface()
+	{
+		static TaskInterface singleton;
+		return &singleton;
+	}
+}
@@ -0,0 +1,28 @@
+#include "file_watcher.h"
+#include "helper_game.h"
+
+/* Stand-ins for helper_game.cpp and file_watcher.cpp, which need the running game and Win32, for
+* the host targets that link the real main_plugin.cpp: no sounds, stamina as a percentage of a 100
+* point pool, the working directory in place of the game's, and a watcher that never fires.
+*/
+namespace helper
+{
+	float GetAVPercent(RE::Actor* a_a, RE::ActorValue a_v)
+	{
+		return a_a ? a_a->AsActorValueOwner()->GetActorValue(a_v) / 100.f : 0.f;
+	}
+
+	bool InitializeSound(RE::BSSoundHandle&, std::string) { return false; }
+
+	bool PlaySound(RE::BSSoundHandle&, float, RE::NiPoint3&, RE::NiAVObject*) { return false; }
+
+	std::filesystem::path GetGamePath() { return std::filesystem::current_path(); }
+
+	void FileWatcher::Start(std::filesystem::path a_path, Callback a_on_change)
+	{
+		path = std::move(a_path);
+		on_change = std::move(a_on_change);
+	}
+
+	void FileWatcher::Stop() {}
+}
@@ -0,0 +1,17 @@
+#include "plugin_stubs.h"
+
+namespace stubs
+{
+	std::atomic<bool>     g_game_stopped = false;
+	std::atomic<uint32_t> g_on_update_calls = 0;
+}
+
+namespace menuchecker
+{
+	bool isGameStopped() { return stubs::g_game_stopped.load(std::memory_order_relaxed); }
+}
+
+namespace arrownock
+{
+	void OnUpdate() { stubs::g_on_update_calls.fetch_add(1, std::memory_order_relaxed); }
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/* State behind the stub arrownock and menuchecker translation units (plugin_stubs.cpp), which
+* stand in for main_plugin.cpp and menu_checker.cpp where those would need the game.
+*/
+namespace stubs
+{
+	// returned by menuchecker::isGameStopped
+	extern std::atomic<bool> g_game_stopped;
+
+	// calls of arrownock::OnUpdate made by the pose callback
+	extern std::atomic<uint32_t> g_on_update_calls;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "VR/openvr.h"
+
+#include <atomic>
+
+/* IVRSystem that only counts haptic pulses, for PulseDispatcher::Start and vrinput::g_IVRSystem.
+* Every other call reports nothing.
+*/
+class StubVRSystem : public vr::IVRSystem
+{
+public:
+	std::atomic<uint32_t> pulses = 0;
+	std::atomic<uint32_t> pulse_us = 0;
+
+	void TriggerHapticPulse(vr::TrackedDeviceIndex_t, uint32_t, unsigned short a_duration) override
+	{
+		pulses.fetch_add(1, std::memory_order_relaxed);
+		pulse_us.fetch_add(a_duration, std::memory_order_relaxed);
+	}
+
+	void GetRecommendedRenderTargetSize(uint32_t*, uint32_t*) override {}
+	vr::HmdMatrix44_t GetProjectionMatrix(vr::EVREye, float, float) override { return {}; }
+	void GetProjectionRaw(vr::EVREye, float*, float*, float*, float*) override {}
+	bool ComputeDistortion(vr::EVREye, float, float,
+		vr::DistortionCoordinates_t*) override { return {}; }
+	vr::HmdMatrix34_t GetEyeToHeadTransform(vr::EVREye) override { return {}; }
+	bool GetTimeSinceLastVsync(float*, uint64_t*) override { return {}; }
+	int32_t GetD3D9AdapterIndex() override { return {}; }
+	void GetDXGIOutputInfo(int32_t*) override {}
+	void GetOutputDevice(uint64_t*, vr::ETextureType, VkInstance_T*) override {}
+	bool IsDisplayOnDesktop() override { return {}; }
+	bool SetDisplayVisibility(bool) override { return {}; }
+	void GetDeviceToAbsoluteTrackingPose(vr::ETrackingUniverseOrigin, float,
+		vr::TrackedDevicePose_t*, uint32_t) override {}
+	void ResetSeatedZeroPose() override {}
+	vr::HmdMatrix34_t GetSeatedZeroPoseToStandingAbsoluteTrackingPose() override { return {}; }
+	vr::HmdMatrix34_t GetRawZeroPoseToStandingAbsoluteTrackingPose() override { return {}; }
+	uint32_t GetSortedTrackedDeviceIndicesOfClass(vr::ETrackedDeviceClass,
+		vr::TrackedDeviceIndex_t*, uint32_t, vr::TrackedDeviceIndex_t) override { return {}; }
+	vr::EDeviceActivityLevel GetTrackedDeviceActivityLevel(vr::TrackedDeviceIndex_t) override
+	{
+		return {};
+	}
+	void ApplyTransform(vr::TrackedDevicePose_t*, const vr::TrackedDevicePose_t*,
+		const vr::HmdMatrix34_t*) override {}
+	vr::TrackedDeviceIndex_t GetTrackedDeviceIndexForControllerRole(
+		vr::ETrackedControllerRole) override
+	{
+		return {};
+	}
+	vr::ETrackedControllerRole GetControllerRoleForTrackedDeviceIndex(
+		vr::TrackedDeviceIndex_t) override
+	{
+		return {};
+	}
+	vr::ETrackedDeviceClass GetTrackedDeviceClass(vr::TrackedDeviceIndex_t) override { return {}; }
+	bool IsTrackedDeviceConnected(vr::TrackedDeviceIndex_t) override { return {}; }
+	bool GetBoolTrackedDeviceProperty(vr::TrackedDeviceIndex_t, vr::ETrackedDeviceProperty,
+		vr::ETrackedPropertyError*) override { return {}; }
+	float GetFloatTrackedDeviceProperty(vr::TrackedDeviceIndex_t, vr::ETrackedDeviceProperty,
+		vr::ETrackedPropertyError*) override { return {}; }
+	int32_t GetInt32TrackedDeviceProperty(vr::TrackedDeviceIndex_t, vr::ETrackedDeviceProperty,
+		vr::ETrackedPropertyError*) override { return {}; }
+	uint64_t GetUint64TrackedDeviceProperty(vr::TrackedDeviceIndex_t, vr::ETrackedDeviceProperty,
+		vr::ETrackedPropertyError*) override { return {}; }
+	vr::HmdMatrix34_t GetMatrix34TrackedDeviceProperty(vr::TrackedDeviceIndex_t,
+		vr::ETrackedDeviceProperty, vr::ETrackedPropertyError*) override { return {}; }
+	uint32_t GetArrayTrackedDeviceProperty(vr::TrackedDeviceIndex_t, vr::ETrackedDeviceProperty,
+		vr::PropertyTypeTag_t, void*, uint32_t, vr::ETrackedPropertyError*) override { return {}; }
+	uint32_t GetStringTrackedDeviceProperty(vr::TrackedDeviceIndex_t, vr::ETrackedDeviceProperty,
+		char*, uint32_t, vr::ETrackedPropertyError*) override { return {}; }
+	const char* GetPropErrorNameFromEnum(vr::ETrackedPropertyError) override { return {}; }
+	bool PollNextEvent(vr::VREvent_t*, uint32_t) override { return {}; }
+	bool PollNextEventWithPose(vr::ETrackingUniverseOrigin, vr::VREvent_t*, uint32_t,
+		vr::TrackedDevicePose_t*) override { return {}; }
+	const char* GetEventTypeNameFromEnum(vr::EVREventType) override { return {}; }
+	vr::HiddenAreaMesh_t GetHiddenAreaMesh(vr::EVREye,
+		vr::EHiddenAreaMeshType) override { return {}; }
+	bool GetControllerState(vr::TrackedDeviceIndex_t, vr::VRControllerState_t*,
+		uint32_t) override { return {}; }
+	bool GetControllerStateWithPose(vr::ETrackingUniverseOrigin, vr::TrackedDeviceIndex_t,
+		vr::VRControllerState_t*, uint32_t, vr::TrackedDevicePose_t*) override { return {}; }
+	const char* GetButtonIdNameFromEnum(vr::EVRButtonId) override { return {}; }
+	const char* GetControllerAxisTypeNameFromEnum(vr::EVRControllerAxisType) override { return {}; }
+	bool IsInputAvailable() override { return {}; }
+	bool IsSteamVRDrawingControllers() override { return {}; }
+	bool ShouldApplicationPause() override { return {}; }
+	bool ShouldApplicationReduceRenderingWork() override { return {}; }
+	uint32_t DriverDebugRequest(vr::TrackedDeviceIndex_t, const char*, char*,
+		uint32_t) override { return {}; }
+	vr::EVRFirmwareError PerformFirmwareUpdate(vr::TrackedDeviceIndex_t) override { return {}; }
+	void AcknowledgeQuit_Exiting() override {}
+	void AcknowledgeQuit_UserPrompt() override {}
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+/* Host stand-in for the few Win32 names the plugin headers use. No module ever loads */
+using HANDLE = void*;
+using HMODULE = void*;
+using FARPROC = void (*)();
+
+inline HMODULE LoadLibraryA(const char*) { return nullptr; }
+inline HMODULE GetModuleHandleA(const char*) { return nullptr; }
+inline FARPROC GetProcAddress(HMODULE, const char*) { return nullptr; }
@@ -0,0 +1,43 @@
+#pragma once
+
+/* Host stand-in for Xbyak: accepts the instructions vrinput emits and generates nothing, so
+* getCode returns null and the input callback skips the write into the caller's stack.
+*/
+namespace Xbyak
+{
+	struct Operand
+	{
+		Operand operator-(int) const { return {}; }
+		Operand operator+(int) const { return {}; }
+	};
+
+	struct Address
+	{
+		Operand operator[](const Operand&) const { return {}; }
+	};
+
+	class CodeGenerator
+	{
+	public:
+		template <class... Args>
+		void mov(const Args&...)
+		{}
+		template <class... Args>
+		void or_(const Args&...)
+		{}
+		template <class... Args>
+		void movss(const Args&...)
+		{}
+		void ret() {}
+		void ready() {}
+
+		template <class F>
+		F getCode() const
+		{
+			return nullptr;
+		}
+
+		const Address ptr;
+		const Operand rbp, r12, r13, xmm0, xmm1, xmm2, xmm14, xmm15;
+	};
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+/* Minimal checks and timing for the host tests and benchmarks. A test program returns
+* test::Failures() from main, so ctest fails if any CHECK did.
+*/
+namespace test
+{
+	inline int& FailureCount()
+	{
+		static int count = 0;
+		return count;
+	}
+
+	inline int Failures()
+	{
+		if (FailureCount()) { std::printf("%d check(s) failed\n", FailureCount()); }
+		return FailureCount() != 0;
+	}
+
+	// heap allocations made by the program so far, counted by alloc_counter.cpp when linked in
+	extern std::atomic<uint64_t> g_allocations;
+
+	/* returns: average nanoseconds per call of a_func over a_iterations calls */
+	template <typename F>
+	double NsPerCall(uint64_t a_iterations, F&& a_func)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (uint64_t i = 0; i < a_iterations; i++) { a_func(i); }
+		auto elapsed = std::chrono::steady_clock::now() - start;
+		return std::chrono::duration<double, std::nano>(elapsed).count() / a_iterations;
+	}
+
+	/* keeps a_value alive so the optimizer can not drop the computation behind it */
+	template <typename T>
+	inline void DoNotOptimize(const T& a_value)
+	{
+		asm volatile("" : : "r,m"(a_value) : "memory");
+	}
+}
+
+#define CHECK(a_condition)                                                             \
+	do {                                                                               \
+		if (!(a_condition))                                                            \
+		{                                                                              \
+			std::printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #a_condition); \
+			test::FailureCount()++;                                                    \
+		}                                                                              \
+	} while (0)
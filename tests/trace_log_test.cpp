@@ -0,0 +1,46 @@
+#include "test_util.h"
+#include "trace_log.h"
+
+/* Formatting of trace records, built with the float cast overflow sanitizer so a conversion of a
+* value out of int64 range fails the test instead of printing garbage
+*/
+namespace
+{
+	using tracelog::Event;
+
+	std::string FormatOne(double a_value)
+	{
+		tracelog::Record record{ 0, Event::kIsArrowNocked, 1, { a_value } };
+		auto             text = tracelog::Format(record);
+		return text.substr(text.find(": ") + 2);
+	}
+}
+
+int main()
+{
+	CHECK(FormatOne(42) == "42");
+	CHECK(FormatOne(-3) == "-3");
+	CHECK(FormatOne(-0.0) == "0");
+	CHECK(FormatOne(0.5) == "0.5");
+	CHECK(FormatOne(-0x1p63) == "-9223372036854775808");
+	CHECK(FormatOne(0x1p63) == "9.223372036854776e+18");
+	CHECK(FormatOne(-0x1p64) == "-1.8446744073709552e+19");
+	CHECK(FormatOne(1e300) == "1e+300");
+	CHECK(FormatOne(std::numeric_limits<double>::infinity()) == "inf");
+	CHECK(FormatOne(-std::numeric_limits<double>::infinity()) == "-inf");
+	CHECK(FormatOne(std::numeric_limits<double>::quiet_NaN()) == "nan");
+
+	// missing arguments leave their placeholder empty, extra ones are ignored
+	tracelog::Record state{ 0, Event::kStateChange, 1, { 2 } };
+	CHECK(tracelog::Format(state) == "STATE CHANGE:  2 to ");
+	tracelog::Record clear{ 0, Event::kClearFake, 2, { 1, 2 } };
+	CHECK(tracelog::Format(clear) == "clearing fake button states");
+	CHECK(tracelog::Format({ 0, Event::kCount, 0, {} }) == "unknown trace event");
+
+	// every event has a format, and all four arguments are placed
+	for (auto format : tracelog::kEventFormats) { CHECK(!format.empty()); }
+	tracelog::Record rotation{ 0, Event::kUnbentRotation, 4, { 1, 0, -0.5, 0.25 } };
+	CHECK(tracelog::Format(rotation) == "Got unbent rotation: 1 0 -0.5 0.25");
+
+	return test::Failures();
+}
@@ -0,0 +1,301 @@
+#include "plugin_stubs.h"
+#include "test_util.h"
+#include "vr_system_stub.h"
+#include "vrinput.h"
+
+#include <cinttypes>
+
+/* Drives the real ControllerInputCallback and ControllerPoseCallback with VRControllerState_t
+* streams. The scripted part checks the bitmasks written to the output state, the benchmark part
+* prints ns/call and heap allocations per call for each stream.
+* The plugin's own button callbacks (arrownock::OnButtonEvent) need the game, so the callbacks
+* registered here are local ones that block or count like it does.
+*/
+namespace
+{
+	using namespace vrinput;
+
+	constexpr vr::TrackedDeviceIndex_t kRightDevice = 1;
+	constexpr vr::TrackedDeviceIndex_t kLeftDevice = 2;
+	constexpr uint64_t                 kTrigger = 1ull << vr::k_EButton_SteamVR_Trigger;
+	constexpr uint64_t                 kGrip = 1ull << vr::k_EButton_Grip;
+	constexpr uint64_t                 kA = 1ull << vr::k_EButton_A;
+	constexpr uint64_t                 kDpadRight = 1ull << vr::k_EButton_DPad_Right;
+
+	StubVRSystem g_vr_system;
+
+	struct Counters
+	{
+		uint32_t trigger = 0;
+		uint32_t dpad = 0;
+		uint32_t hold = 0;
+	} g_counters;
+
+	// blocks the press like the stamina inhibitor does, lets the release through
+	bool BlockTriggerPress(const ModInputEvent& e)
+	{
+		g_counters.trigger++;
+		return e.button_state == ButtonState::kButtonDown;
+	}
+
+	bool CountDpad(const ModInputEvent&)
+	{
+		g_counters.dpad++;
+		return false;
+	}
+
+	bool CountHold(const ModInputEvent&)
+	{
+		g_counters.hold++;
+		return false;
+	}
+
+	vr::VRControllerState_t MakeState(
+		uint64_t a_pressed, float a_joystick_x = 0.f, float a_joystick_y = 0.f)
+	{
+		vr::VRControllerState_t state{};
+		state.ulButtonPressed = a_pressed;
+		state.ulButtonTouched = a_pressed;
+		state.rAxis[0] = { a_joystick_x, a_joystick_y };
+		state.rAxis[1].x = (a_pressed & kTrigger) ? 1.f : 0.f;
+		return state;
+	}
+
+	/* One poll as the hook does it: the output starts as a copy of the input */
+	vr::VRControllerState_t Poll(
+		vr::TrackedDeviceIndex_t a_device, const vr::VRControllerState_t& a_in)
+	{
+		vr::VRControllerState_t out = a_in;
+		ControllerInputCallback(a_device, &a_in, sizeof(a_in), &out);
+		return out;
+	}
+
+	void Script()
+	{
+		// a blocked press stays blocked while the button is held
+		auto out = Poll(kRightDevice, MakeState(kTrigger));
+		CHECK(out.ulButtonPressed == 0);
+		CHECK(g_counters.trigger == 1);
+		out = Poll(kRightDevice, MakeState(kTrigger));
+		CHECK(out.ulButtonPressed == 0);
+		CHECK(g_counters.trigger == 1);
+		out = Poll(kRightDevice, MakeState(0));
+		CHECK(out.ulButtonPressed == 0);
+		CHECK(g_counters.trigger == 2);
+
+		// the callback is only registered for the right hand
+		out = Poll(kLeftDevice, MakeState(kTrigger));
+		CHECK(out.ulButtonPressed == kTrigger);
+		Poll(kLeftDevice, MakeState(0));
+
+		// a held fake button is or'ed into every poll of its hand until cleared
+		ModInputEvent fake_a{ Hand::kRight, ActionType::kPress, ButtonState::kButtonDown,
+			vr::k_EButton_A };
+		SetFakeButtonState(fake_a);
+		CHECK(Poll(kRightDevice, MakeState(kGrip)).ulButtonPressed == (kGrip | kA));
+		CHECK(Poll(kRightDevice, MakeState(0)).ulButtonPressed == kA);
+		CHECK(Poll(kLeftDevice, MakeState(0)).ulButtonPressed == 0);
+		ClearFakeButtonState(fake_a);
+		CHECK(Poll(kRightDevice, MakeState(0)).ulButtonPressed == 0);
+
+		// a fake release masks the real press
+		SetFakeButtonState({ Hand::kLeft, ActionType::kPress, ButtonState::kButtonUp,
+			vr::k_EButton_Grip });
+		CHECK(Poll(kLeftDevice, MakeState(kGrip)).ulButtonPressed == 0);
+		ClearAllFake();
+		CHECK(Poll(kLeftDevice, MakeState(kGrip)).ulButtonPressed == kGrip);
+		Poll(kLeftDevice, MakeState(0));
+
+		// a momentary event lasts for one poll
+		SendFakeInputEvent({ Hand::kRight, ActionType::kPress, ButtonState::kButtonDown,
+			vr::k_EButton_Grip });
+		CHECK(Poll(kRightDevice, MakeState(0)).ulButtonPressed == kGrip);
+		CHECK(Poll(kRightDevice, MakeState(0)).ulButtonPressed == 0);
+
+		// the joystick presses an emulated dpad direction past the press radius and releases it
+		// below the release radius
+		uint32_t dpad = g_counters.dpad;
+		Poll(kRightDevice, MakeState(0, 0.6f, 0.f));
+		CHECK(g_counters.dpad == dpad);
+		Poll(kRightDevice, MakeState(0, 0.8f, 0.f));
+		CHECK(g_counters.dpad == dpad + 1);
+		Poll(kRightDevice, MakeState(0, 0.6f, 0.f));
+		CHECK(g_counters.dpad == dpad + 1);
+		Poll(kRightDevice, MakeState(0, 0.4f, 0.f));
+		CHECK(g_counters.dpad == dpad + 2);
+
+		// blocking everything zeroes the buttons and the joystick
+		StartBlockingAll();
+		out = Poll(kLeftDevice, MakeState(kGrip | kA, 0.5f, 0.5f));
+		CHECK(out.ulButtonPressed == 0 && out.ulButtonTouched == 0);
+		CHECK(out.rAxis[0].x == 0.f && out.rAxis[0].y == 0.f);
+		StopBlockingAll();
+		Poll(kLeftDevice, MakeState(0));
+
+		// nothing is processed while a menu stops the game
+		stubs::g_game_stopped = true;
+		uint32_t trigger = g_counters.trigger;
+		CHECK(Poll(kRightDevice, MakeState(kTrigger)).ulButtonPressed == kTrigger);
+		CHECK(g_counters.trigger == trigger);
+		stubs::g_game_stopped = false;
+		Poll(kRightDevice, MakeState(0));
+
+		// a hold whose button is released while a menu stops the game never fires
+		vr::TrackedDevicePose_t poses[3] = {};
+		Poll(kLeftDevice, MakeState(kGrip));
+		stubs::g_game_stopped = true;
+		Poll(kLeftDevice, MakeState(0));
+		auto start = std::chrono::steady_clock::now();
+		while (std::chrono::steady_clock::now() - start < 150ms)
+		{
+			ControllerPoseCallback(nullptr, 0, poses, 3);
+			std::this_thread::sleep_for(5ms);
+		}
+		stubs::g_game_stopped = false;
+		Poll(kLeftDevice, MakeState(0));
+		CHECK(g_counters.hold == 0);
+
+		// hold callbacks fire from the pose callback once the duration has passed
+		Poll(kLeftDevice, MakeState(kGrip));
+		start = std::chrono::steady_clock::now();
+		while (!g_counters.hold && std::chrono::steady_clock::now() - start < 1s)
+		{
+			ControllerPoseCallback(nullptr, 0, poses, 3);
+			std::this_thread::sleep_for(5ms);
+		}
+		CHECK(g_counters.hold == 1);
+		CHECK(std::chrono::steady_clock::now() - start >= 50ms);
+		Poll(kLeftDevice, MakeState(0));
+
+		// a haptic pattern mixed on the pose thread reaches the driver through the dispatcher
+		static const haptics::Pattern pattern({ 2000, 2000, 2000 }, 90.f);
+		Vibrate(false, pattern);
+		start = std::chrono::steady_clock::now();
+		while (!g_vr_system.pulses && std::chrono::steady_clock::now() - start < 1s)
+		{
+			ControllerPoseCallback(nullptr, 0, poses, 3);
+			std::this_thread::sleep_for(1ms);
+		}
+		CHECK(g_vr_system.pulses > 0);
+	}
+
+	struct StreamResult
+	{
+		double   ns_per_call;
+		double   allocations_per_call;
+		uint64_t last_pressed;
+		uint64_t last_touched;
+		uint64_t checksum;  // of every output bitmask, to compare runs
+	};
+
+	template <typename F>
+	StreamResult RunStream(uint64_t a_polls, F&& a_make_input)
+	{
+		StreamResult result{};
+		vr::VRControllerState_t out{};
+
+		auto allocations = test::g_allocations.load();
+		result.ns_per_call = test::NsPerCall(a_polls, [&](uint64_t i) {
+			auto [device, in] = a_make_input(i);
+			out = in;
+			ControllerInputCallback(device, &in, sizeof(in), &out);
+			result.checksum = (result.checksum ^ out.ulButtonPressed ^ out.ulButtonTouched << 1) *
+				0x100000001b3ull;
+		});
+		result.allocations_per_call =
+			double(test::g_allocations.load() - allocations) / (double)a_polls;
+		result.last_pressed = out.ulButtonPressed;
+		result.last_touched = out.ulButtonTouched;
+		return result;
+	}
+
+	void Report(const char* a_name, const StreamResult& a_result)
+	{
+		std::printf("%-16s %8.1f ns/call %6.3f allocs/call  pressed %016" PRIx64
+					" touched %016" PRIx64 "  checksum %016" PRIx64 "\n",
+			a_name, a_result.ns_per_call, a_result.allocations_per_call, a_result.last_pressed,
+			a_result.last_touched, a_result.checksum);
+
+		// nothing on the input path may allocate once the callbacks are registered
+		CHECK(a_result.allocations_per_call == 0.0);
+	}
+
+	void Benchmark(uint64_t a_polls)
+	{
+		using Input = std::pair<vr::TrackedDeviceIndex_t, vr::VRControllerState_t>;
+
+		auto both_hands = [](uint64_t i) { return i & 1 ? kLeftDevice : kRightDevice; };
+
+		Report("idle", RunStream(a_polls, [&](uint64_t i) {
+			return Input{ both_hands(i), MakeState(kGrip) };
+		}));
+
+		Report("trigger toggle", RunStream(a_polls, [&](uint64_t i) {
+			return Input{ both_hands(i), MakeState(i & 16 ? kTrigger : 0) };
+		}));
+
+		Report("joystick circle", RunStream(a_polls, [&](uint64_t i) {
+			float angle = (float)(i % 360) * std::numbers::pi_v<float> / 180;
+			return Input{ both_hands(i), MakeState(0, std::cos(angle), std::sin(angle)) };
+		}));
+
+		SetFakeButtonState({ Hand::kBoth, ActionType::kPress, ButtonState::kButtonDown,
+			vr::k_EButton_SteamVR_Trigger });
+		Report("fake held", RunStream(a_polls, [&](uint64_t i) {
+			return Input{ both_hands(i), MakeState(kGrip) };
+		}));
+		ClearAllFake();
+
+		Report("fake momentary", RunStream(a_polls, [&](uint64_t i) {
+			if (i % 8 == 0)
+			{
+				SendFakeInputEvent({ Hand::kRight, ActionType::kPress, ButtonState::kButtonDown,
+					vr::k_EButton_A });
+			}
+			return Input{ both_hands(i), MakeState(0) };
+		}));
+
+		// pose thread, with and without smoothing
+		vr::TrackedDevicePose_t poses[3] = {};
+		for (auto& pose : poses)
+		{
+			pose.bPoseIsValid = true;
+			for (int i = 0; i < 3; i++) { pose.mDeviceToAbsoluteTracking.m[i][i] = 1.f; }
+		}
+		for (bool smooth : { false, true })
+		{
+			smooth ? StartSmoothing() : StopSmoothing();
+			auto   allocations = test::g_allocations.load();
+			double ns = test::NsPerCall(a_polls / 4, [&](uint64_t i) {
+				poses[kRightDevice].mDeviceToAbsoluteTracking.m[0][3] = (float)(i % 100) * 1e-3f;
+				ControllerPoseCallback(nullptr, 0, poses, 3);
+			});
+			double allocs = double(test::g_allocations.load() - allocations) / (a_polls / 4);
+			std::printf("%-16s %8.1f ns/call %6.3f allocs/call\n",
+				smooth ? "pose smoothed" : "pose", ns, allocs);
+			CHECK(allocs == 0.0);
+		}
+		StopSmoothing();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	g_rightcontroller = kRightDevice;
+	g_leftcontroller = kLeftDevice;
+	g_IVRSystem = &g_vr_system;
+	InitControllerHooks();
+	haptics::PulseDispatcher::GetSingleton()->Start(g_IVRSystem);
+
+	AddCallback(BlockTriggerPress, vr::k_EButton_SteamVR_Trigger, Hand::kRight, ActionType::kPress);
+	AddCallback(CountDpad, vr::k_EButton_DPad_Right, Hand::kBoth, ActionType::kPress);
+	AddHoldCallback(CountHold, 50ms, vr::k_EButton_Grip, Hand::kLeft, ActionType::kPress);
+
+	Script();
+
+	uint64_t polls = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+	Benchmark(polls);
+
+	haptics::PulseDispatcher::GetSingleton()->Stop();
+	return test::Failures();
+}